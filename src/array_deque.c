@@ -0,0 +1,260 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+
+#define P_SIZE sizeof(intptr_t)
+#define this ((ArrayDeque *) _this)
+
+#define MIN_CAPACITY 8
+
+/**
+ * Elements live in a ring buffer whose capacity is always a power of two,
+ * so positions wrap with a mask instead of a division.
+ */
+typedef struct _deque_private {
+    void **values;
+    unsigned long head;
+    unsigned long dequeSize;
+    unsigned long capacity;
+} Private;
+
+static inline unsigned long position(Private *private, unsigned long index) {
+
+    return (private->head + index) & (private->capacity - 1);
+}
+
+/** Doubles the ring buffer and unwraps the elements to its start */
+static void grow(Private *private) {
+
+    unsigned long newCapacity = private->capacity ? private->capacity << 1 : MIN_CAPACITY;
+    void **values = malloc((size_t) newCapacity * P_SIZE);
+
+    unsigned long firstPart = private->capacity - private->head;
+    if (firstPart > private->dequeSize)
+        firstPart = private->dequeSize;
+
+    if (private->dequeSize) {
+        memcpy(values, private->values + private->head, (size_t) firstPart * P_SIZE);
+        memcpy(values + firstPart, private->values,
+               (size_t) (private->dequeSize - firstPart) * P_SIZE);
+    }
+
+    free(private->values);
+    private->values = values;
+    private->head = 0;
+    private->capacity = newCapacity;
+
+}
+
+extern void __CComp_ArrayDeque_implList_add(void *_this, void *value) {
+
+    Private *private = (Private *) this->_private;
+    if (private->dequeSize == private->capacity)
+        grow(private);
+
+    private->values[position(private, private->dequeSize)] = value;
+    private->dequeSize++;
+
+}
+
+/** Shifts whichever side of the removed element is shorter */
+extern void __CComp_ArrayDeque_implList_remove
+            (void *_this, unsigned long index) {
+
+    Private *private = (Private *) this->_private;
+
+    if (index < private->dequeSize >> 1) {
+        for (unsigned long cursor = index; cursor; cursor--)
+            private->values[position(private, cursor)] =
+                private->values[position(private, cursor - 1)];
+
+        private->head = position(private, 1);
+    } else {
+        for (unsigned long cursor = index; cursor + 1 < private->dequeSize; cursor++)
+            private->values[position(private, cursor)] =
+                private->values[position(private, cursor + 1)];
+    }
+
+    private->dequeSize--;
+
+}
+
+extern void __CComp_ArrayDeque_implList_set
+            (void *_this, unsigned long index, void *value) {
+
+    Private *private = (Private *) this->_private;
+    private->values[position(private, index)] = value;
+}
+
+extern void *__CComp_ArrayDeque_implList_get
+            (void *_this, unsigned long index) {
+
+    Private *private = (Private *) this->_private;
+    return private->values[position(private, index)];
+}
+
+extern unsigned long __CComp_ArrayDeque_implList_length(void *_this) {
+
+    return ((Private *) this->_private)->dequeSize;
+}
+
+static bool iteratorHasNext(ListIterator *iterator) {
+
+    return iterator->index < ((Private *) ((ArrayDeque *) iterator->list)->_private)->dequeSize;
+}
+
+static void *iteratorNext(ListIterator *iterator) {
+
+    Private *private = (Private *) ((ArrayDeque *) iterator->list)->_private;
+    return private->values[position(private, iterator->index++)];
+}
+
+static void iteratorRemove(ListIterator *iterator) {
+
+    __CComp_ArrayDeque_implList_remove(iterator->list, --iterator->index);
+}
+
+extern ListIterator __CComp_ArrayDeque_implList_iterator(void *_this) {
+
+    ListIterator iterator = { this, NULL, 0, &iteratorHasNext, &iteratorNext, &iteratorRemove };
+    return iterator;
+}
+
+String *__CComp_ArrayDeque_implObject_toString(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    String *result = CreateString("ArrayDeque: [ ");
+    for (unsigned long index = 0; index < private->dequeSize; index++) {
+
+        result->class->addULong(result,
+            (unsigned long) private->values[position(private, index)]);
+        if (index != private->dequeSize - 1)
+            result->class->add(result, ", ");
+
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, private->dequeSize);
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+extern void *__CComp_ArrayDeque_implObject_copy(void *_this) {
+
+    ArrayDeque *result = createArrayDeque();
+
+    Private *privateSrc = (Private *) this->_private;
+    Private *privateDst = (Private *) result->_private;
+
+    if (!privateSrc->dequeSize)
+        return result;
+
+    privateDst->capacity = privateSrc->capacity;
+    privateDst->values = malloc((size_t) privateDst->capacity * P_SIZE);
+    for (unsigned long index = 0; index < privateSrc->dequeSize; index++)
+        privateDst->values[index] = privateSrc->values[position(privateSrc, index)];
+
+    privateDst->dequeSize = privateSrc->dequeSize;
+
+    return result;
+
+}
+
+extern void __CComp_ArrayDeque_addFirst(void *_this, void *value) {
+
+    Private *private = (Private *) this->_private;
+    if (private->dequeSize == private->capacity)
+        grow(private);
+
+    private->head = position(private, private->capacity - 1);
+    private->values[private->head] = value;
+    private->dequeSize++;
+
+}
+
+extern void *__CComp_ArrayDeque_getFirst(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    return private->dequeSize ? private->values[private->head] : NULL;
+}
+
+extern void *__CComp_ArrayDeque_getLast(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    return private->dequeSize ?
+        private->values[position(private, private->dequeSize - 1)] : NULL;
+}
+
+extern void __CComp_ArrayDeque_removeFirst(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    if (!private->dequeSize)
+        return;
+
+    private->head = position(private, 1);
+    private->dequeSize--;
+
+}
+
+extern void __CComp_ArrayDeque_removeLast(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    if (private->dequeSize)
+        private->dequeSize--;
+}
+
+extern ArrayDeque *createArrayDeque() {
+
+    ArrayDeque *newArrayDeque = (ArrayDeque *) malloc(sizeof(ArrayDeque));
+    Private *private = (Private *) malloc(sizeof(Private));
+    private->values = NULL;
+    private->head = private->dequeSize = private->capacity = 0;
+    newArrayDeque->_private = private;
+    newArrayDeque->class = &ClassArrayDeque;
+    newArrayDeque->_class = &classArrayDeque;
+
+    return newArrayDeque;
+
+}
+
+extern void __CComp_Cls_ArrayDeque_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    free(private->values);
+    free(private);
+    free(this);
+
+}
+
+ClassArrayDequeType ClassArrayDeque = {
+    &__CComp_ArrayDeque_addFirst,
+    &__CComp_ArrayDeque_getFirst,
+    &__CComp_ArrayDeque_getLast,
+    &__CComp_ArrayDeque_removeFirst,
+    &__CComp_ArrayDeque_removeLast,
+    {
+        INTERFACE_LIST,
+        &__CComp_ArrayDeque_implList_add,
+        &__CComp_ArrayDeque_implList_remove,
+        &__CComp_ArrayDeque_implList_set,
+        &__CComp_ArrayDeque_implList_get,
+        &__CComp_ArrayDeque_implList_length,
+        &__CComp_ArrayDeque_implList_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_ArrayDeque_implObject_toString,
+            &__CComp_ArrayDeque_implObject_copy
+        }
+    }
+};
+
+Class classArrayDeque = {
+    .classType = CLASS_ARRAY_DEQUE,
+    .delete    = &__CComp_Cls_ArrayDeque_delete
+};
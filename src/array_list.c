@@ -1,3 +1,5 @@
+#include <pthread.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -7,51 +9,429 @@
 #define P_SIZE sizeof(intptr_t)
 #define this ((ArrayList *) _this)
 
+#define INLINE_CAPACITY 8
+
+/** Heap storage of a list, shared by copies until one of them is modified */
+typedef struct _list_buffer {
+    atomic_ulong references;
+    void *values[];
+} Buffer;
+
 typedef struct _list_private {
     void **listValue;
     unsigned long int listSize;
+    unsigned long int listCapacity;
+    /** NULL while the elements are kept in inlineValue */
+    Buffer *buffer;
+    /** Holds the first elements until the list outgrows it, then listValue moves to the heap */
+    void *inlineValue[INLINE_CAPACITY];
 } Private;
 
+/** The list and its private state are allocated as one block */
+typedef struct _list_instance {
+    ArrayList list;
+    Private private;
+} Instance;
+
+static inline bool isShared(Private *private) {
+    return private->buffer && atomic_load(&private->buffer->references) > 1;
+}
+
+static void releaseBuffer(Buffer *buffer) {
+    if (atomic_fetch_sub(&buffer->references, 1) == 1)
+        free(buffer);
+}
+
+static void reallocate(Private *private, unsigned long int capacity) {
+    Buffer *buffer;
+
+    if (private->buffer && !isShared(private))
+        buffer = (Buffer *) realloc(private->buffer, sizeof(Buffer) + (size_t) (capacity * P_SIZE));
+    else {
+        buffer = (Buffer *) malloc(sizeof(Buffer) + (size_t) (capacity * P_SIZE));
+        atomic_init(&buffer->references, 1);
+        memcpy(buffer->values, private->listValue, (size_t) (private->listSize * P_SIZE));
+
+        if (private->buffer)
+            releaseBuffer(private->buffer);
+    }
+
+    private->buffer = buffer;
+    private->listValue = buffer->values;
+    private->listCapacity = capacity;
+}
+
+/** Gives the list its own copy of a buffer it shares, must precede every write to listValue */
+static inline void makeWritable(Private *private) {
+    if (isShared(private))
+        reallocate(private, private->listCapacity);
+}
+
+/** Grows the backing array geometrically so a run of appends is amortized O(1) */
+static void ensureCapacity(Private *private, unsigned long int required) {
+    if (required <= private->listCapacity) {
+        makeWritable(private);
+        return;
+    }
+
+    unsigned long int newCapacity = private->listCapacity;
+    while (newCapacity < required)
+        newCapacity += newCapacity >> 1;
+
+    reallocate(private, newCapacity);
+}
+
+#define INSERTION_SORT_THRESHOLD 16
+
+static void insertionSort(void **values, unsigned long int count, Comparator comparator) {
+    for (unsigned long int index = 1; index < count; index++) {
+        void *value = values[index];
+        unsigned long int hole = index;
+
+        for (; hole && comparator(values[hole - 1], value) > 0; hole--)
+            values[hole] = values[hole - 1];
+
+        values[hole] = value;
+    }
+}
+
+static void siftDown(void **values, unsigned long int root, unsigned long int count, Comparator comparator) {
+    void *value = values[root];
+
+    for (unsigned long int child; (child = 2 * root + 1) < count; root = child) {
+        if (child + 1 < count && comparator(values[child], values[child + 1]) < 0)
+            child++;
+
+        if (comparator(value, values[child]) >= 0)
+            break;
+
+        values[root] = values[child];
+    }
+
+    values[root] = value;
+}
+
+static void heapSort(void **values, unsigned long int count, Comparator comparator) {
+    for (unsigned long int root = count / 2; root--;)
+        siftDown(values, root, count, comparator);
+
+    for (unsigned long int last = count - 1; last; last--) {
+        void *top = values[0];
+        values[0] = values[last];
+        values[last] = top;
+
+        siftDown(values, 0, last, comparator);
+    }
+}
+
+static inline void swapValues(void **values, unsigned long int a, unsigned long int b) {
+    void *value = values[a];
+    values[a] = values[b];
+    values[b] = value;
+}
+
+/** Orders values[a], values[b], values[c] in place */
+static inline void sortThree(void **values, unsigned long int a, unsigned long int b,
+                             unsigned long int c, Comparator comparator) {
+    if (comparator(values[b], values[a]) < 0)
+        swapValues(values, a, b);
+    if (comparator(values[c], values[b]) < 0) {
+        swapValues(values, b, c);
+        if (comparator(values[b], values[a]) < 0)
+            swapValues(values, a, b);
+    }
+}
+
+/**
+ * Introsort: quicksort with a median-of-three pivot that falls back to heapsort
+ * once the recursion gets deeper than 2 log2(n), and finishes short ranges with
+ * insertion sort. Recurses into the smaller half only, so the stack stays O(log n).
+ */
+static void introSort(void **values, unsigned long int count, unsigned int depthLimit, Comparator comparator) {
+    while (count > INSERTION_SORT_THRESHOLD) {
+        if (!depthLimit--) {
+            heapSort(values, count, comparator);
+            return;
+        }
+
+        unsigned long int middle = count / 2;
+        sortThree(values, 0, middle, count - 1, comparator);
+        void *pivot = values[middle];
+
+        unsigned long int left = 0, right = count - 1;
+        for (;;) {
+            while (comparator(values[++left], pivot) < 0);
+            while (comparator(pivot, values[--right]) < 0);
+
+            if (left >= right)
+                break;
+
+            swapValues(values, left, right);
+        }
+
+        unsigned long int split = right + 1;
+        if (split < count - split) {
+            introSort(values, split, depthLimit, comparator);
+            values += split;
+            count -= split;
+        } else {
+            introSort(values + split, count - split, depthLimit, comparator);
+            count = split;
+        }
+    }
+
+    insertionSort(values, count, comparator);
+}
+
+static void sortValues(void **values, unsigned long int count, Comparator comparator) {
+    unsigned int depthLimit = 0;
+    for (unsigned long int rest = count; rest > 1; rest >>= 1)
+        depthLimit += 2;
+
+    introSort(values, count, depthLimit, comparator);
+}
+
+/** Below this count per thread parallelSort sorts on the calling thread */
+#define PARALLEL_SORT_GRAIN 32768
+
+/** State shared by the workers of one parallelSort */
+typedef struct _sort_job {
+    void **values;
+    void **buffer;
+    /** Bounds of the chunks sorted first, runs of later rounds start at every stride-th bound */
+    unsigned long int *bounds;
+    unsigned long int chunkCount;
+    /** Set before the workers are let go, includes the calling thread */
+    unsigned long int workerCount;
+    Comparator comparator;
+
+    pthread_mutex_t lock;
+    pthread_cond_t released;
+    unsigned long int waiting;
+    unsigned long int generation;
+} SortJob;
+
+typedef struct _sort_worker {
+    SortJob *job;
+    unsigned long int id;
+} SortWorker;
+
+/** Blocks until every worker of the job has called it */
+static void awaitWorkers(SortJob *job) {
+    pthread_mutex_lock(&job->lock);
+
+    unsigned long int generation = job->generation;
+    if (++job->waiting == job->workerCount) {
+        job->waiting = 0;
+        job->generation++;
+        pthread_cond_broadcast(&job->released);
+    } else {
+        while (generation == job->generation)
+            pthread_cond_wait(&job->released, &job->lock);
+    }
+
+    pthread_mutex_unlock(&job->lock);
+}
+
+static void mergeRuns(void **left, unsigned long int leftCount, void **right, unsigned long int rightCount,
+                      void **output, Comparator comparator) {
+    void **leftEnd = left + leftCount, **rightEnd = right + rightCount;
+
+    while (left < leftEnd && right < rightEnd)
+        *output++ = comparator(*right, *left) < 0 ? *right++ : *left++;
+
+    memcpy(output, left, (size_t) (leftEnd - left) * P_SIZE);
+    memcpy(output + (leftEnd - left), right, (size_t) (rightEnd - right) * P_SIZE);
+}
+
+static unsigned long int lowerBound(void **values, unsigned long int count, void *value, Comparator comparator) {
+    unsigned long int low = 0, high = count;
+
+    while (low < high) {
+        unsigned long int middle = low + (high - low) / 2;
+        if (comparator(values[middle], value) < 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+/**
+ * Merges one segment of a pair of runs. Every pair is cut into parts segments
+ * at evenly spaced points of its first run, the matching split points of the
+ * second run are found by binary search, so the segments are independent.
+ */
+static void mergeSegment(SortJob *job, void **source, void **target, unsigned long int stride,
+                         unsigned long int parts, unsigned long int segment) {
+    unsigned long int *bounds = job->bounds;
+    unsigned long int pair = segment / parts, part = segment % parts;
+
+    unsigned long int leftStart = bounds[2 * pair * stride];
+    unsigned long int rightStart = bounds[(2 * pair + 1) * stride];
+    unsigned long int rightEnd = (2 * pair + 2) * stride < job->chunkCount ?
+        bounds[(2 * pair + 2) * stride] : bounds[job->chunkCount];
+
+    void **left = source + leftStart, **right = source + rightStart;
+    unsigned long int leftCount = rightStart - leftStart, rightCount = rightEnd - rightStart;
+
+    unsigned long int leftFrom = leftCount * part / parts;
+    unsigned long int leftTo = part + 1 == parts ? leftCount : leftCount * (part + 1) / parts;
+    unsigned long int rightFrom = part ? lowerBound(right, rightCount, left[leftFrom], job->comparator) : 0;
+    unsigned long int rightTo = part + 1 == parts ? rightCount :
+        lowerBound(right, rightCount, left[leftTo], job->comparator);
+
+    mergeRuns(left + leftFrom, leftTo - leftFrom, right + rightFrom, rightTo - rightFrom,
+              target + leftStart + leftFrom + rightFrom, job->comparator);
+}
+
+/**
+ * Sorts its share of the chunks, then takes part in every merge round, meeting
+ * the other workers between rounds. Returns where the sorted values ended up.
+ */
+static void *sortWorker(void *argument) {
+    SortWorker *worker = (SortWorker *) argument;
+    SortJob *job = worker->job;
+
+    // The calling thread holds the lock until every worker has been started
+    pthread_mutex_lock(&job->lock);
+    unsigned long int workerCount = job->workerCount;
+    pthread_mutex_unlock(&job->lock);
+
+    unsigned long int chunkCount = job->chunkCount;
+    for (unsigned long int chunk = worker->id; chunk < chunkCount; chunk += workerCount)
+        sortValues(job->values + job->bounds[chunk], job->bounds[chunk + 1] - job->bounds[chunk], job->comparator);
+
+    void **source = job->values, **target = job->buffer;
+    for (unsigned long int stride = 1; stride < chunkCount; stride *= 2) {
+        awaitWorkers(job);
+
+        unsigned long int runs = (chunkCount + stride - 1) / stride;
+        unsigned long int pairs = runs / 2;
+        unsigned long int parts = chunkCount / pairs;
+
+        for (unsigned long int task = worker->id; task < pairs * parts + runs % 2; task += workerCount) {
+            if (task < pairs * parts) {
+                mergeSegment(job, source, target, stride, parts, task);
+                continue;
+            }
+
+            // The odd run out is carried over to the next round as it is
+            unsigned long int start = job->bounds[(runs - 1) * stride];
+            memcpy(target + start, source + start, (job->bounds[chunkCount] - start) * P_SIZE);
+        }
+
+        void **swap = source;
+        source = target;
+        target = swap;
+    }
+
+    return source;
+}
+
+/**
+ * Sorts equal chunks on separate threads, then merges pairs of sorted runs
+ * round by round. The threads are started once and wait for each other
+ * between rounds; every pairwise merge is cut into segments so that all of
+ * them stay busy in the last rounds too.
+ */
+static void parallelSortValues(void **values, unsigned long int count,
+                               unsigned long int threadCount, Comparator comparator) {
+    if (threadCount > count / PARALLEL_SORT_GRAIN)
+        threadCount = count / PARALLEL_SORT_GRAIN;
+
+    if (threadCount < 2) {
+        sortValues(values, count, comparator);
+        return;
+    }
+
+    SortJob job;
+    job.values = values;
+    job.buffer = (void **) malloc((size_t) count * P_SIZE);
+    job.bounds = (unsigned long int *) malloc((size_t) (threadCount + 1) * sizeof(unsigned long int));
+    job.chunkCount = threadCount;
+    job.comparator = comparator;
+    job.waiting = 0;
+    job.generation = 0;
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.released, NULL);
+
+    for (unsigned long int index = 0; index <= threadCount; index++)
+        job.bounds[index] = count / threadCount * index + count % threadCount * index / threadCount;
+
+    pthread_t *threads = (pthread_t *) malloc((size_t) threadCount * sizeof(pthread_t));
+    SortWorker *workers = (SortWorker *) malloc((size_t) threadCount * sizeof(SortWorker));
+
+    // Workers that can not be started are left out, the others share their chunks
+    unsigned long int started = 1;
+    pthread_mutex_lock(&job.lock);
+    for (; started < threadCount; started++) {
+        workers[started].job = &job;
+        workers[started].id = started;
+        if (pthread_create(&threads[started], NULL, &sortWorker, &workers[started]))
+            break;
+    }
+
+    job.workerCount = started;
+    pthread_mutex_unlock(&job.lock);
+
+    workers[0].job = &job;
+    workers[0].id = 0;
+    void **sorted = (void **) sortWorker(&workers[0]);
+
+    for (unsigned long int index = 1; index < started; index++)
+        pthread_join(threads[index], NULL);
+
+    if (sorted != values)
+        memcpy(values, sorted, (size_t) count * P_SIZE);
+
+    pthread_cond_destroy(&job.released);
+    pthread_mutex_destroy(&job.lock);
+    free(workers);
+    free(threads);
+    free(job.bounds);
+    free(job.buffer);
+}
+
+/** Returns the index of the first element that is not less (or, if upper, not less or equal) than value */
+static unsigned long int searchBound(Private *private, void *value, Comparator comparator, bool upper) {
+    unsigned long int low = 0, high = private->listSize;
+
+    while (low < high) {
+        unsigned long int middle = low + (high - low) / 2;
+        int comparison = comparator(private->listValue[middle], value);
+
+        if (comparison < 0 || (upper && !comparison))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
 extern void __CComp_ArrayList_implList_add(void *_this, void *value) {
     Private *private = (Private *) this->_private;
-    Private *oldPrivate  = (Private *) malloc(sizeof(Private));
-    
-    unsigned long int arraySize = P_SIZE * private->listSize;
-    oldPrivate->listValue = (void **) malloc((size_t) arraySize);
-    memcpy(oldPrivate->listValue, private->listValue, (size_t) arraySize);
-    
-    private->listValue = (void **) malloc((size_t) (arraySize + P_SIZE));
-    memcpy(private->listValue, oldPrivate->listValue, (size_t) arraySize);
-
-    memcpy(&private->listValue[private->listSize], &value, (size_t) P_SIZE);
-    private->listSize++;
 
-    free(oldPrivate->listValue);
-    free(oldPrivate);
+    ensureCapacity(private, private->listSize + 1);
+    private->listValue[private->listSize++] = value;
 }
 
 extern void __CComp_ArrayList_implList_remove(void *_this, unsigned long int index) {
     Private *private = (Private *) this->_private;
+    makeWritable(private);
 
-    Private *oldPrivate  = (Private *) malloc(sizeof(Private));
-    oldPrivate->listValue = private->listValue;
-
-    unsigned long int arraySize = P_SIZE * (private->listSize - 1);
-    private->listValue = (void **) malloc((size_t) arraySize);
-    
-    memcpy(private->listValue, oldPrivate->listValue, (size_t) (index * P_SIZE));
-    memcpy(private->listValue + index,
-            oldPrivate->listValue + (index + 1), 
-            (size_t) (arraySize + P_SIZE - (index + 1) * P_SIZE));
+    memmove(private->listValue + index,
+            private->listValue + (index + 1),
+            (size_t) ((private->listSize - index - 1) * P_SIZE));
 
     private->listSize--;
-
-    free(oldPrivate->listValue);
-    free(oldPrivate);
 }
 
 extern void __CComp_ArrayList_implList_set(void *_this, unsigned long int index, void *value) {
     Private *private = (Private *) this->_private;
+    makeWritable(private);
 
     memcpy(&private->listValue[index], &value, (size_t) P_SIZE);
 }
@@ -66,6 +446,23 @@ extern unsigned long int __CComp_ArrayList_implList_length(void *_this) {
     return ((Private *) this->_private)->listSize;
 }
 
+static bool iteratorHasNext(ListIterator *iterator) {
+    return iterator->index < ((Private *) ((ArrayList *) iterator->list)->_private)->listSize;
+}
+
+static void *iteratorNext(ListIterator *iterator) {
+    return ((Private *) ((ArrayList *) iterator->list)->_private)->listValue[iterator->index++];
+}
+
+static void iteratorRemove(ListIterator *iterator) {
+    __CComp_ArrayList_implList_remove(iterator->list, --iterator->index);
+}
+
+extern ListIterator __CComp_ArrayList_implList_iterator(void *_this) {
+    ListIterator iterator = { this, NULL, 0, &iteratorHasNext, &iteratorNext, &iteratorRemove };
+    return iterator;
+}
+
 extern String *__CComp_ArrayList_implObject_toString(void *_this) {
     unsigned long int listLength = __CComp_ArrayList_implList_length(this);
     String *result = CreateString("ArrayList: [ ");
@@ -87,21 +484,151 @@ extern void *__CComp_ArrayList_implObject_copy(void *_this) {
     Private *private = (Private *) this->_private;
 
     ArrayList *newArrayList = CreateArrayList();
-    newArrayList->class->include(newArrayList, private->listValue, private->listSize);
+    if (!private->buffer) {
+        newArrayList->class->include(newArrayList, private->listValue, private->listSize);
+        return newArrayList;
+    }
+
+    Private *newPrivate = (Private *) newArrayList->_private;
+    atomic_fetch_add(&private->buffer->references, 1);
+    newPrivate->buffer = private->buffer;
+    newPrivate->listValue = private->listValue;
+    newPrivate->listSize = private->listSize;
+    newPrivate->listCapacity = private->listCapacity;
 
     return newArrayList;
 }
 
+extern void __CComp_ArrayList_insertRange(void *_this, unsigned long int index,
+                                          void **array, unsigned long int count) {
+    Private *private = (Private *) this->_private;
+
+    ensureCapacity(private, private->listSize + count);
+    memmove(private->listValue + index + count,
+            private->listValue + index,
+            (size_t) ((private->listSize - index) * P_SIZE));
+    memcpy(private->listValue + index, array, (size_t) (count * P_SIZE));
+
+    private->listSize += count;
+}
+
 extern void __CComp_ArrayList_include(void *_this, void **array, unsigned long int count) {
-    for (int index = 0; index < count; index++) {
-        this->class->_impl_List.add(this, *(array + index));
-    }
+    __CComp_ArrayList_insertRange(this, ((Private *) this->_private)->listSize, array, count);
+}
+
+extern void __CComp_ArrayList_insertAt(void *_this, unsigned long int index, void *value) {
+    __CComp_ArrayList_insertRange(this, index, &value, 1);
+}
+
+/** Removes the elements in [from, to) with a single shift of the tail */
+extern void __CComp_ArrayList_removeRange(void *_this, unsigned long int from, unsigned long int to) {
+    Private *private = (Private *) this->_private;
+    makeWritable(private);
+
+    memmove(private->listValue + from,
+            private->listValue + to,
+            (size_t) ((private->listSize - to) * P_SIZE));
+
+    private->listSize -= to - from;
+}
+
+extern void __CComp_ArrayList_truncate(void *_this, unsigned long int length) {
+    Private *private = (Private *) this->_private;
+
+    if (length < private->listSize)
+        private->listSize = length;
+}
+
+extern void __CComp_ArrayList_clear(void *_this) {
+    ((Private *) this->_private)->listSize = 0;
+}
+
+/** Moves the last element into the removed one's place, so the order is not kept */
+extern void __CComp_ArrayList_swapRemove(void *_this, unsigned long int index) {
+    Private *private = (Private *) this->_private;
+    makeWritable(private);
+
+    private->listValue[index] = private->listValue[--private->listSize];
+}
+
+/** Removes the last element and returns it, NULL if the list is empty */
+extern void *__CComp_ArrayList_pop(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    return private->listSize ? private->listValue[--private->listSize] : NULL;
+}
+
+extern void __CComp_ArrayList_sort(void *_this, Comparator comparator) {
+    Private *private = (Private *) this->_private;
+    makeWritable(private);
+
+    sortValues(private->listValue, private->listSize, comparator);
+}
+
+/** Sorts using up to the given count of threads; short lists are sorted on the calling thread */
+extern void __CComp_ArrayList_parallelSort(void *_this, Comparator comparator, unsigned int threads) {
+    Private *private = (Private *) this->_private;
+    makeWritable(private);
+
+    parallelSortValues(private->listValue, private->listSize, threads, comparator);
+}
+
+/** The list must be sorted with the same comparator. Returns -1 if there is no equal element */
+extern long int __CComp_ArrayList_binarySearch(void *_this, void *value, Comparator comparator) {
+    Private *private = (Private *) this->_private;
+    unsigned long int index = searchBound(private, value, comparator, false);
+
+    if (index == private->listSize || comparator(private->listValue[index], value))
+        return -1;
+
+    return (long int) index;
+}
+
+/** Inserts the value after all elements that are not greater than it, returns its index */
+extern unsigned long int __CComp_ArrayList_insertSorted(void *_this, void *value, Comparator comparator) {
+    Private *private = (Private *) this->_private;
+    unsigned long int index = searchBound(private, value, comparator, true);
+
+    __CComp_ArrayList_insertRange(this, index, &value, 1);
+    return index;
+}
+
+extern void __CComp_ArrayList_reserve(void *_this, unsigned long int capacity) {
+    Private *private = (Private *) this->_private;
+
+    if (capacity > private->listCapacity)
+        reallocate(private, capacity);
+}
+
+extern unsigned long int __CComp_ArrayList_capacity(void *_this) {
+    return ((Private *) this->_private)->listCapacity;
+}
+
+extern void __CComp_ArrayList_shrinkToFit(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    if (!private->buffer || private->listSize == private->listCapacity)
+        return;
+
+    if (private->listSize <= INLINE_CAPACITY) {
+        memcpy(private->inlineValue, private->listValue, (size_t) (private->listSize * P_SIZE));
+        releaseBuffer(private->buffer);
+
+        private->buffer = NULL;
+        private->listValue = private->inlineValue;
+        private->listCapacity = INLINE_CAPACITY;
+    } else
+        reallocate(private, private->listSize);
 }
 
 extern ArrayList *createArrayList() {
-    ArrayList *newArrayList = (ArrayList *) malloc(sizeof(ArrayList));
-    Private *private = (Private *) malloc(sizeof(Private));
+    Instance *instance = (Instance *) malloc(sizeof(Instance));
+    ArrayList *newArrayList = &instance->list;
+    Private *private = &instance->private;
+    private->listValue = private->inlineValue;
+    private->buffer = NULL;
     private->listSize = 0;
+    private->listCapacity = INLINE_CAPACITY;
     newArrayList->_private = private;
     newArrayList->class = &ClassArrayList;
     newArrayList->_class = &classArrayList;
@@ -112,13 +639,27 @@ extern ArrayList *createArrayList() {
 extern void __CComp_Cls_ArrayList_delete(void *_this) {
     Private *private = (Private *) this->_private;
 
-    free(private->listValue);
-    free(private);
+    if (private->buffer)
+        releaseBuffer(private->buffer);
     free(this);
 }
 
 ClassArrayListType ClassArrayList = {
     &__CComp_ArrayList_include,
+    &__CComp_ArrayList_insertAt,
+    &__CComp_ArrayList_insertRange,
+    &__CComp_ArrayList_removeRange,
+    &__CComp_ArrayList_truncate,
+    &__CComp_ArrayList_clear,
+    &__CComp_ArrayList_swapRemove,
+    &__CComp_ArrayList_pop,
+    &__CComp_ArrayList_sort,
+    &__CComp_ArrayList_parallelSort,
+    &__CComp_ArrayList_binarySearch,
+    &__CComp_ArrayList_insertSorted,
+    &__CComp_ArrayList_reserve,
+    &__CComp_ArrayList_capacity,
+    &__CComp_ArrayList_shrinkToFit,
     {
         INTERFACE_LIST,
         &__CComp_ArrayList_implList_add,
@@ -126,6 +667,7 @@ ClassArrayListType ClassArrayList = {
         &__CComp_ArrayList_implList_set,
         &__CComp_ArrayList_implList_get,
         &__CComp_ArrayList_implList_length,
+        &__CComp_ArrayList_implList_iterator,
         {
             INTERFACE_CCOBJECT,
             &__CComp_ArrayList_implObject_toString,
@@ -0,0 +1,240 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+
+#define this ((ArrayListOf *) _this)
+
+typedef struct _list_of_private {
+    char *listValue;
+    size_t elementSize;
+    unsigned long int listSize;
+    unsigned long int listCapacity;
+} Private;
+
+#define MIN_CAPACITY 8
+
+#define ELEMENT(PRIVATE, INDEX) ((PRIVATE)->listValue + (size_t) (INDEX) * (PRIVATE)->elementSize)
+
+static void ensureCapacity(Private *private, unsigned long int required) {
+    if (required <= private->listCapacity)
+        return;
+
+    unsigned long int newCapacity = private->listCapacity ? private->listCapacity : MIN_CAPACITY;
+    while (newCapacity < required)
+        newCapacity += newCapacity >> 1;
+
+    private->listValue = (char *) realloc(private->listValue, (size_t) newCapacity * private->elementSize);
+    private->listCapacity = newCapacity;
+}
+
+extern void *__CComp_ArrayListOf_at(void *_this, unsigned long int index) {
+    Private *private = (Private *) this->_private;
+
+    return ELEMENT(private, index);
+}
+
+/** Copies the record into a new slot at the end; a NULL record gives a zeroed slot */
+extern void *__CComp_ArrayListOf_push(void *_this, void *record) {
+    Private *private = (Private *) this->_private;
+
+    ensureCapacity(private, private->listSize + 1);
+    void *slot = ELEMENT(private, private->listSize++);
+
+    if (record)
+        memcpy(slot, record, private->elementSize);
+    else
+        memset(slot, 0, private->elementSize);
+
+    return slot;
+}
+
+extern bool __CComp_ArrayListOf_pop(void *_this, void *record) {
+    Private *private = (Private *) this->_private;
+
+    if (!private->listSize)
+        return false;
+
+    private->listSize--;
+    if (record)
+        memcpy(record, ELEMENT(private, private->listSize), private->elementSize);
+
+    return true;
+}
+
+extern void __CComp_ArrayListOf_pushRange(void *_this, void *records, unsigned long int count) {
+    Private *private = (Private *) this->_private;
+
+    ensureCapacity(private, private->listSize + count);
+    memcpy(ELEMENT(private, private->listSize), records, (size_t) count * private->elementSize);
+
+    private->listSize += count;
+}
+
+extern void __CComp_ArrayListOf_copyRange(void *_this, unsigned long int from,
+                                          unsigned long int count, void *records) {
+    Private *private = (Private *) this->_private;
+
+    memcpy(records, ELEMENT(private, from), (size_t) count * private->elementSize);
+}
+
+extern size_t __CComp_ArrayListOf_elementSize(void *_this) {
+    return ((Private *) this->_private)->elementSize;
+}
+
+extern void __CComp_ArrayListOf_reserve(void *_this, unsigned long int capacity) {
+    Private *private = (Private *) this->_private;
+
+    if (capacity <= private->listCapacity)
+        return;
+
+    private->listValue = (char *) realloc(private->listValue, (size_t) capacity * private->elementSize);
+    private->listCapacity = capacity;
+}
+
+extern unsigned long int __CComp_ArrayListOf_capacity(void *_this) {
+    return ((Private *) this->_private)->listCapacity;
+}
+
+extern void __CComp_ArrayListOf_shrinkToFit(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    if (private->listSize == private->listCapacity)
+        return;
+
+    if (!private->listSize) {
+        free(private->listValue);
+        private->listValue = NULL;
+    } else
+        private->listValue = (char *) realloc(private->listValue,
+                                              (size_t) private->listSize * private->elementSize);
+
+    private->listCapacity = private->listSize;
+}
+
+extern void __CComp_ArrayListOf_implList_add(void *_this, void *value) {
+    __CComp_ArrayListOf_push(this, value);
+}
+
+extern void __CComp_ArrayListOf_implList_remove(void *_this, unsigned long int index) {
+    Private *private = (Private *) this->_private;
+
+    memmove(ELEMENT(private, index),
+            ELEMENT(private, index + 1),
+            (size_t) (private->listSize - index - 1) * private->elementSize);
+
+    private->listSize--;
+}
+
+/** Copies the record over the slot; a NULL record zeroes it */
+extern void __CComp_ArrayListOf_implList_set(void *_this, unsigned long int index, void *value) {
+    Private *private = (Private *) this->_private;
+
+    if (value)
+        memcpy(ELEMENT(private, index), value, private->elementSize);
+    else
+        memset(ELEMENT(private, index), 0, private->elementSize);
+}
+
+extern void *__CComp_ArrayListOf_implList_get(void *_this, unsigned long int index) {
+    Private *private = (Private *) this->_private;
+
+    return ELEMENT(private, index);
+}
+
+extern unsigned long int __CComp_ArrayListOf_implList_length(void *_this) {
+    return ((Private *) this->_private)->listSize;
+}
+
+static bool iteratorHasNext(ListIterator *iterator) {
+    return iterator->index < ((Private *) ((ArrayListOf *) iterator->list)->_private)->listSize;
+}
+
+static void *iteratorNext(ListIterator *iterator) {
+    Private *private = (Private *) ((ArrayListOf *) iterator->list)->_private;
+
+    return ELEMENT(private, iterator->index++);
+}
+
+static void iteratorRemove(ListIterator *iterator) {
+    __CComp_ArrayListOf_implList_remove(iterator->list, --iterator->index);
+}
+
+extern ListIterator __CComp_ArrayListOf_implList_iterator(void *_this) {
+    ListIterator iterator = { this, NULL, 0, &iteratorHasNext, &iteratorNext, &iteratorRemove };
+    return iterator;
+}
+
+extern String *__CComp_ArrayListOf_implObject_toString(void *_this) {
+    Private *private = (Private *) this->_private;
+    String *result = CreateString("ArrayListOf: [ ");
+
+    result->class->addULong(result, (unsigned long int) private->elementSize);
+    result->class->add(result, " bytes ] (");
+    result->class->addULong(result, private->listSize);
+    result->class->add(result, ");");
+    return result;
+}
+
+extern void *__CComp_ArrayListOf_implObject_copy(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    ArrayListOf *newArrayListOf = createArrayListOf(private->elementSize);
+    newArrayListOf->class->pushRange(newArrayListOf, private->listValue, private->listSize);
+
+    return newArrayListOf;
+}
+
+extern ArrayListOf *createArrayListOf(size_t elementSize) {
+    ArrayListOf *newArrayListOf = (ArrayListOf *) malloc(sizeof(ArrayListOf));
+    Private *private = (Private *) malloc(sizeof(Private));
+    private->listValue = NULL;
+    private->elementSize = elementSize;
+    private->listSize = 0;
+    private->listCapacity = 0;
+    newArrayListOf->_private = private;
+    newArrayListOf->class = &ClassArrayListOf;
+    newArrayListOf->_class = &classArrayListOf;
+
+    return newArrayListOf;
+}
+
+extern void __CComp_Cls_ArrayListOf_delete(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    free(private->listValue);
+    free(private);
+    free(this);
+}
+
+ClassArrayListOfType ClassArrayListOf = {
+    &__CComp_ArrayListOf_at,
+    &__CComp_ArrayListOf_push,
+    &__CComp_ArrayListOf_pop,
+    &__CComp_ArrayListOf_pushRange,
+    &__CComp_ArrayListOf_copyRange,
+    &__CComp_ArrayListOf_elementSize,
+    &__CComp_ArrayListOf_reserve,
+    &__CComp_ArrayListOf_capacity,
+    &__CComp_ArrayListOf_shrinkToFit,
+    {
+        INTERFACE_LIST,
+        &__CComp_ArrayListOf_implList_add,
+        &__CComp_ArrayListOf_implList_remove,
+        &__CComp_ArrayListOf_implList_set,
+        &__CComp_ArrayListOf_implList_get,
+        &__CComp_ArrayListOf_implList_length,
+        &__CComp_ArrayListOf_implList_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_ArrayListOf_implObject_toString,
+            &__CComp_ArrayListOf_implObject_copy
+        }
+    }
+};
+
+Class classArrayListOf = {
+    .classType = CLASS_ARRAY_LIST_OF,
+    .delete    = &__CComp_Cls_ArrayListOf_delete
+};
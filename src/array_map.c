@@ -1,66 +1,172 @@
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ccomponents.h"
+#include "util/hash.h"
 
-#define P_SIZE sizeof(intptr_t)
 #define this ((ArrayMap *) _this)
 
+#define MIN_INDEX_CAPACITY 8
+
+/** A position of the hash index, entry is the index of the key in keys plus one or 0 if the slot is empty */
+struct slot {
+    uint64_t hash;
+    unsigned long int entry;
+};
+
+/**
+ * keys and values keep the insertion order, the index maps hashes to their
+ * positions. Removed entries stay as NULL keys until the next compaction.
+ */
 typedef struct _map_private {
     ArrayList *values;
     ArrayList *keys;
     unsigned long int mapSize;
+    struct slot *index;
+    /** A power of two, kept at most 2/3 full with both used and removed entries */
+    unsigned long int indexCapacity;
 } Private;
 
-static long int indexOfKey(ArrayList *keys, char *key) {
-    for (unsigned long int index = 0; index < keys->class->_impl_List.length(keys); index++) {
-        String *currentKey = (String *) keys->class->_impl_List.get(keys, index);
-        if (currentKey->class->equalsChr(currentKey, key))
-            return index;
-    } return -1;
+static inline uint64_t hashOf(char *key) {
+    return _hash_bytes(key, strlen(key));
+}
+
+/** Returns the slot of the key, or the empty slot where it would be inserted */
+static unsigned long int findSlot(Private *private, char *key, uint64_t hash) {
+    ArrayList *keys = private->keys;
+    unsigned long int mask = private->indexCapacity - 1;
+
+    for (unsigned long int position = hash & mask;; position = (position + 1) & mask) {
+        struct slot *slot = &private->index[position];
+        if (!slot->entry)
+            return position;
+
+        if (slot->hash == hash) {
+            String *currentKey = (String *) keys->class->_impl_List.get(keys, slot->entry - 1);
+            if (currentKey && currentKey->class->equalsChr(currentKey, key))
+                return position;
+        }
+    }
+}
+
+/** Returns the index of the key in keys, or the length of keys if the map has no such key */
+static unsigned long int indexOfKey(Private *private, char *key) {
+    struct slot *slot = &private->index[findSlot(private, key, hashOf(key))];
+
+    return slot->entry ? slot->entry - 1 : private->keys->class->_impl_List.length(private->keys);
+}
+
+/** Drops the removed entries and rebuilds the index with the given capacity */
+static void rebuildIndex(Private *private, unsigned long int capacity) {
+    ArrayList *keys = private->keys;
+    ArrayList *values = private->values;
+    unsigned long int used = keys->class->_impl_List.length(keys);
+
+    // The old index is the only place the hashes are kept
+    uint64_t *hashes = (uint64_t *) malloc((used ? used : 1) * sizeof(uint64_t));
+    for (unsigned long int position = 0; position < private->indexCapacity; position++)
+        if (private->index[position].entry)
+            hashes[private->index[position].entry - 1] = private->index[position].hash;
+
+    if (used != private->mapSize) {
+        unsigned long int kept = 0;
+        for (unsigned long int entry = 0; entry < used; entry++) {
+            void *key = keys->class->_impl_List.get(keys, entry);
+            if (!key)
+                continue;
+
+            keys->class->_impl_List.set(keys, kept, key);
+            values->class->_impl_List.set(values, kept, values->class->_impl_List.get(values, entry));
+            hashes[kept++] = hashes[entry];
+        }
+
+        keys->class->truncate(keys, kept);
+        values->class->truncate(values, kept);
+        used = kept;
+    }
+
+    free(private->index);
+    private->index = (struct slot *) calloc(capacity, sizeof(struct slot));
+    private->indexCapacity = capacity;
+
+    unsigned long int mask = capacity - 1;
+    for (unsigned long int entry = 0; entry < used; entry++) {
+        unsigned long int position = hashes[entry] & mask;
+        while (private->index[position].entry)
+            position = (position + 1) & mask;
+
+        private->index[position].hash = hashes[entry];
+        private->index[position].entry = entry + 1;
+    }
+
+    free(hashes);
+}
+
+/** Leaves room to add as many entries as there are now before the next rebuild */
+static unsigned long int capacityFor(unsigned long int count) {
+    unsigned long int capacity = MIN_INDEX_CAPACITY;
+    while (capacity * 2 < count * 6)
+        capacity <<= 1;
+
+    return capacity;
 }
 
 extern void __CComp_ArrayMap_implMap_remove(void *_this, char *key) {
     Private *private = (Private *) this->_private;
+    ArrayList *keys = private->keys;
 
-    unsigned long int index = indexOfKey(private->keys, key);
+    unsigned long int index = indexOfKey(private, key);
+    if (index == keys->class->_impl_List.length(keys))
+        return;
 
-    delete(((String *) private->keys->class->_impl_List.get(private->keys, index)));
-    private->keys->class->_impl_List.remove(private->keys, index);
-    private->values->class->_impl_List.remove(private->values, index);
+    delete(((String *) keys->class->_impl_List.get(keys, index)));
+    keys->class->_impl_List.set(keys, index, NULL);
+    private->values->class->_impl_List.set(private->values, index, NULL);
 
     private->mapSize--;
+
+    // Compacts once removed entries outnumber the remaining ones
+    if (keys->class->_impl_List.length(keys) - private->mapSize > private->mapSize)
+        rebuildIndex(private, capacityFor(private->mapSize + 1));
 }
 
 extern void __CComp_ArrayMap_implMap_set(void *_this, char *key, void *value) {
     Private *private = (Private *) this->_private;
-    unsigned long int index = indexOfKey(private->keys, key);
-
-    if (index == -1) {
-        String *newKey = CreateString(key);
-        private->keys->class->_impl_List.add(private->keys, newKey);
+    ArrayList *keys = private->keys;
 
-        void *randomMemory = malloc((size_t) P_SIZE);
-        private->values->class->_impl_List.add(private->values, randomMemory);
-        free(randomMemory);
+    uint64_t hash = hashOf(key);
+    unsigned long int position = findSlot(private, key, hash);
 
-        private->mapSize++;
+    if (private->index[position].entry) {
+        private->values->class->_impl_List.set(private->values, private->index[position].entry - 1, value);
+        return;
+    }
 
-        // More fast then call indexOfKey() again
-        index = private->keys->class->_impl_List.length(private->keys) - 1;
+    unsigned long int used = keys->class->_impl_List.length(keys);
+    if ((used + 1) * 3 > private->indexCapacity * 2) {
+        rebuildIndex(private, capacityFor(private->mapSize + 1));
+        used = private->mapSize;
+        position = findSlot(private, key, hash);
     }
 
-    private->values->class->_impl_List.set(private->values, index, value);
+    private->index[position].hash = hash;
+    private->index[position].entry = used + 1;
+
+    keys->class->_impl_List.add(keys, CreateString(key));
+    private->values->class->_impl_List.add(private->values, value);
+
+    private->mapSize++;
 }
 
 extern void *__CComp_ArrayMap_implMap_get(void *_this, char *key) {
     Private *private = (Private *) this->_private;
-    long int index = indexOfKey(private->keys, key);
+    struct slot *slot = &private->index[findSlot(private, key, hashOf(key))];
 
-    if (index == -1) //TODO: Catch the element existence by another way. indexOfKey must return unsigned long int
+    if (!slot->entry)
         return NULL;
 
-    return private->values->class->_impl_List.get(private->values, (unsigned long int) index);
+    return private->values->class->_impl_List.get(private->values, slot->entry - 1);
 }
 
 extern unsigned long int __CComp_ArrayMap_implMap_length(void *_this) {
@@ -69,26 +175,94 @@ extern unsigned long int __CComp_ArrayMap_implMap_length(void *_this) {
     return private->mapSize;
 }
 
+extern void __CComp_ArrayMap_implMap_forEachEntry(void *_this, EntryCallback callback, void *context) {
+    Private *private = (Private *) this->_private;
+    ArrayList *keys = private->keys;
+    ArrayList *vals = private->values;
+
+    for (unsigned long int index = 0; index < keys->class->_impl_List.length(keys); index++) {
+        String *k = (String *) keys->class->_impl_List.get(keys, index);
+        if (k && !callback(k->class->getValue(k), vals->class->_impl_List.get(vals, index), context))
+            return;
+    }
+}
+
+/** Skips the removed entries, index is the position in keys to look at next */
+static bool iteratorNext(MapIterator *iterator) {
+    Private *private = (Private *) ((ArrayMap *) iterator->map)->_private;
+    ArrayList *keys = private->keys;
+
+    while (iterator->index < keys->class->_impl_List.length(keys)) {
+        String *k = (String *) keys->class->_impl_List.get(keys, iterator->index);
+        if (!k) {
+            iterator->index++;
+            continue;
+        }
+
+        iterator->key = k->class->getValue(k);
+        iterator->value = private->values->class->_impl_List.get(private->values, iterator->index++);
+        return true;
+    }
+
+    return false;
+}
+
+extern MapIterator __CComp_ArrayMap_implMap_iterator(void *_this) {
+    MapIterator iterator = { this, NULL, 0, &iteratorNext, NULL, NULL };
+    return iterator;
+}
+
+/** Builds an immutable FrozenMap with the same entries, the map itself is not changed */
+extern FrozenMap *__CComp_ArrayMap_freeze(void *_this) {
+    Private *private = (Private *) this->_private;
+    ArrayList *keys = private->keys;
+    ArrayList *vals = private->values;
+
+    char **frozenKeys = (char **) malloc((private->mapSize ? private->mapSize : 1) * sizeof(char *));
+    void **frozenValues = (void **) malloc((private->mapSize ? private->mapSize : 1) * sizeof(void *));
+
+    unsigned long int count = 0;
+    for (unsigned long int index = 0; index < keys->class->_impl_List.length(keys); index++) {
+        String *k = (String *) keys->class->_impl_List.get(keys, index);
+        if (!k)
+            continue;
+
+        frozenKeys[count] = k->class->getValue(k);
+        frozenValues[count++] = vals->class->_impl_List.get(vals, index);
+    }
+
+    FrozenMap *result = createFrozenMap(frozenKeys, frozenValues, count);
+
+    free(frozenKeys);
+    free(frozenValues);
+
+    return result;
+}
+
 extern String *__CComp_ArrayMap_implObject_toString(void *_this) {
-    unsigned long int mapLength = this->class->_impl_Map.length(this);
     Private *private = (Private *) this->_private;
     ArrayList *keys = private->keys;
+    ArrayList *vals = private->values;
 
     String *result = CreateString("ArrayMap: [ ");
-    for (unsigned long int index = 0; index < mapLength; index++) {
+    unsigned long int printed = 0;
+    for (unsigned long int index = 0; index < keys->class->_impl_List.length(keys); index++) {
         String *k = (String *) keys->class->_impl_List.get(keys, index);
-        uintptr_t v = (uintptr_t) this->class->_impl_Map.get(this, k->class->getValue(k));
+        if (!k)
+            continue;
+
+        uintptr_t v = (uintptr_t) vals->class->_impl_List.get(vals, index);
 
         result->class->add(result, k->class->getValue(k));
         result->class->add(result, ":");
         result->class->addULong(result, (unsigned long int) v);
-        if (index != mapLength - 1) {
+        if (++printed != private->mapSize) {
             result->class->add(result, ", ");
         }
     }
 
     result->class->add(result, " ] (");
-    result->class->addULong(result, (unsigned long int) mapLength);
+    result->class->addULong(result, (unsigned long int) private->mapSize);
     result->class->add(result, ");");
 
     return result;
@@ -103,12 +277,35 @@ extern void *__CComp_ArrayMap_implObject_copy(void *_this) {
     Private *private = (Private *) this->_private;
     ArrayList *keys = private->keys;
     ArrayList *vals = private->values;
+    unsigned long int used = keys->class->_impl_List.length(keys);
+
+    // Without removed entries the index can be taken over as it is
+    if (used != private->mapSize) {
+        for (unsigned long int index = 0; index < used; index++) {
+            String *k = (String *) keys->class->_impl_List.get(keys, index);
+            if (k)
+                __CComp_ArrayMap_implMap_set(newArrayMap, k->class->getValue(k),
+                    vals->class->_impl_List.get(vals, index));
+        }
+
+        return newArrayMap;
+    }
 
-    for (unsigned long int index = 0; index < this->class->_impl_Map.length(this); index++) {
-        nKeys->class->_impl_List.add(nKeys, keys->class->_impl_List.get(keys, index));
+    free(nmPrivate->index);
+    nmPrivate->index = (struct slot *) malloc(private->indexCapacity * sizeof(struct slot));
+    nmPrivate->indexCapacity = private->indexCapacity;
+    memcpy(nmPrivate->index, private->index, private->indexCapacity * sizeof(struct slot));
+
+    nKeys->class->reserve(nKeys, used);
+    nVals->class->reserve(nVals, used);
+    for (unsigned long int index = 0; index < used; index++) {
+        String *k = (String *) keys->class->_impl_List.get(keys, index);
+        nKeys->class->_impl_List.add(nKeys, k->class->_impl_CCObject.copy(k));
         nVals->class->_impl_List.add(nVals, vals->class->_impl_List.get(vals, index));
     }
 
+    nmPrivate->mapSize = private->mapSize;
+
     return newArrayMap;
 }
 
@@ -119,6 +316,8 @@ extern ArrayMap *createArrayMap() {
     private->keys    = CreateArrayList();
     private->values  = CreateArrayList();
     private->mapSize = 0;
+    private->index   = (struct slot *) calloc(MIN_INDEX_CAPACITY, sizeof(struct slot));
+    private->indexCapacity = MIN_INDEX_CAPACITY;
 
     newArrayMap->_private = private;
     newArrayMap->class    = &ClassArrayMap;
@@ -130,19 +329,28 @@ extern ArrayMap *createArrayMap() {
 extern void __CComp_Cls_ArrayMap_delete(void *_this) {
     Private *private = (Private *) this->_private;
 
+    List_forEach(private->keys, key, {
+        if (key)
+            delete(((String *) key));
+    });
+
     delete(private->keys);
     delete(private->values);
+    free(private->index);
     free(private);
     free(this);
 }
 
 ClassArrayMapType ClassArrayMap = {
+    &__CComp_ArrayMap_freeze,
     {
         INTERFACE_MAP,
         &__CComp_ArrayMap_implMap_remove,
         &__CComp_ArrayMap_implMap_set,
         &__CComp_ArrayMap_implMap_get,
         &__CComp_ArrayMap_implMap_length,
+        &__CComp_ArrayMap_implMap_forEachEntry,
+        &__CComp_ArrayMap_implMap_iterator,
         {
             INTERFACE_CCOBJECT,
             &__CComp_ArrayMap_implObject_toString,
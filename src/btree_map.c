@@ -0,0 +1,596 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+
+#define this ((BTreeMap *) _this)
+
+#define CACHE_LINE 64
+/** With 8-byte prefixes and key pointers, the search arrays of a node span 4 cache lines each */
+#define NODE_KEYS 32
+/** Every node but the root keeps at least this many keys */
+#define MIN_KEYS (NODE_KEYS / 2 - 1)
+
+/**
+ * Keys are searched by their first 8 bytes, kept next to the key pointers
+ * as big-endian integers, and by strcmp only when those are equal.
+ */
+struct node {
+    bool leaf;
+    unsigned int count;
+    uint64_t prefixes[NODE_KEYS];
+    char *keys[NODE_KEYS];
+};
+
+struct leaf {
+    struct node node;
+    void *values[NODE_KEYS];
+    struct leaf *next;
+};
+
+/** keys[i] is a copy of the least key under children[i + 1] at the time it was chosen */
+struct inner {
+    struct node node;
+    struct node *children[NODE_KEYS + 1];
+};
+
+typedef struct _btree_map_private {
+    struct node *root;
+    unsigned long mapSize;
+} Private;
+
+static inline uint64_t prefixOf(const char *key) {
+
+    uint64_t prefix = 0;
+    for (int index = 0; index < 8 && key[index]; index++)
+        prefix |= (uint64_t) (unsigned char) key[index] << (56 - 8 * index);
+
+    return prefix;
+
+}
+
+static inline int compareKeys(uint64_t prefix, const char *key, uint64_t otherPrefix, const char *otherKey) {
+
+    if (prefix != otherPrefix)
+        return prefix < otherPrefix ? -1 : 1;
+
+    return strcmp(key, otherKey);
+
+}
+
+static char *copyKey(const char *key) {
+
+    size_t size = strlen(key) + 1;
+    return (char *) memcpy(malloc(size), key, size);
+}
+
+static void *allocateNode(size_t size, bool leaf) {
+
+    size = (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+
+    struct node *node = aligned_alloc(CACHE_LINE, size);
+    node->leaf = leaf;
+    node->count = 0;
+
+    return node;
+
+}
+
+#define INNER(NODE) ((struct inner *) (NODE))
+#define LEAF(NODE) ((struct leaf *) (NODE))
+
+/** Returns the first position whose key is not less (upper: greater) than the given one */
+static unsigned int searchNode(struct node *node, const char *key, uint64_t prefix, bool upper) {
+
+    unsigned int low = 0, high = node->count;
+    while (low < high) {
+        unsigned int middle = (low + high) / 2;
+        int comparison = compareKeys(node->prefixes[middle], node->keys[middle], prefix, key);
+
+        if (comparison < 0 || (upper && !comparison))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+
+}
+
+/** Moves count keys (and values or children after the first one) of the node from one position to another */
+static void moveKeys(struct node *node, unsigned int from, unsigned int to, unsigned int count) {
+
+    memmove(node->prefixes + to, node->prefixes + from, count * sizeof(uint64_t));
+    memmove(node->keys + to, node->keys + from, count * sizeof(char *));
+
+    if (node->leaf)
+        memmove(LEAF(node)->values + to, LEAF(node)->values + from, count * sizeof(void *));
+    else
+        memmove(INNER(node)->children + to + 1, INNER(node)->children + from + 1,
+            count * sizeof(struct node *));
+
+}
+
+/** Copies count keys with their values or following children from one node to another */
+static void copyKeys(struct node *target, unsigned int to, struct node *source, unsigned int from, unsigned int count) {
+
+    memcpy(target->prefixes + to, source->prefixes + from, count * sizeof(uint64_t));
+    memcpy(target->keys + to, source->keys + from, count * sizeof(char *));
+
+    if (source->leaf)
+        memcpy(LEAF(target)->values + to, LEAF(source)->values + from, count * sizeof(void *));
+    else
+        memcpy(INNER(target)->children + to + 1, INNER(source)->children + from + 1,
+            count * sizeof(struct node *));
+
+}
+
+static void insertSeparator(struct inner *parent, unsigned int index, uint64_t prefix, char *key, struct node *right) {
+
+    moveKeys(&parent->node, index, index + 1, parent->node.count - index);
+
+    parent->node.prefixes[index] = prefix;
+    parent->node.keys[index] = key;
+    parent->children[index + 1] = right;
+    parent->node.count++;
+
+}
+
+/** Splits the full child in two halves and adds the separator to the parent, which is not full */
+static void splitChild(struct inner *parent, unsigned int index) {
+
+    struct node *child = parent->children[index];
+    unsigned int half = NODE_KEYS / 2;
+
+    if (child->leaf) {
+        struct leaf *right = allocateNode(sizeof(struct leaf), true);
+        copyKeys(&right->node, 0, child, half, NODE_KEYS - half);
+        right->node.count = NODE_KEYS - half;
+        child->count = half;
+
+        right->next = LEAF(child)->next;
+        LEAF(child)->next = right;
+
+        insertSeparator(parent, index, right->node.prefixes[0], copyKey(right->node.keys[0]), &right->node);
+        return;
+    }
+
+    // The middle key moves up instead of being copied
+    struct inner *right = allocateNode(sizeof(struct inner), false);
+    right->children[0] = INNER(child)->children[half + 1];
+    copyKeys(&right->node, 0, child, half + 1, NODE_KEYS - half - 1);
+    right->node.count = NODE_KEYS - half - 1;
+    child->count = half;
+
+    insertSeparator(parent, index, child->prefixes[half], child->keys[half], &right->node);
+
+}
+
+/** Moves the last key of the left sibling to the front of the child */
+static void borrowLeft(struct inner *parent, unsigned int index) {
+
+    struct node *child = parent->children[index];
+    struct node *left = parent->children[index - 1];
+    unsigned int last = left->count - 1;
+
+    moveKeys(child, 0, 1, child->count);
+
+    if (child->leaf) {
+        child->prefixes[0] = left->prefixes[last];
+        child->keys[0] = left->keys[last];
+        LEAF(child)->values[0] = LEAF(left)->values[last];
+
+        free(parent->node.keys[index - 1]);
+        parent->node.prefixes[index - 1] = child->prefixes[0];
+        parent->node.keys[index - 1] = copyKey(child->keys[0]);
+    } else {
+        INNER(child)->children[1] = INNER(child)->children[0];
+        INNER(child)->children[0] = INNER(left)->children[last + 1];
+        child->prefixes[0] = parent->node.prefixes[index - 1];
+        child->keys[0] = parent->node.keys[index - 1];
+
+        parent->node.prefixes[index - 1] = left->prefixes[last];
+        parent->node.keys[index - 1] = left->keys[last];
+    }
+
+    child->count++;
+    left->count--;
+
+}
+
+/** Moves the first key of the right sibling to the end of the child */
+static void borrowRight(struct inner *parent, unsigned int index) {
+
+    struct node *child = parent->children[index];
+    struct node *right = parent->children[index + 1];
+
+    if (child->leaf) {
+        copyKeys(child, child->count, right, 0, 1);
+        moveKeys(right, 1, 0, right->count - 1);
+
+        free(parent->node.keys[index]);
+        parent->node.prefixes[index] = right->prefixes[0];
+        parent->node.keys[index] = copyKey(right->keys[0]);
+    } else {
+        child->prefixes[child->count] = parent->node.prefixes[index];
+        child->keys[child->count] = parent->node.keys[index];
+        INNER(child)->children[child->count + 1] = INNER(right)->children[0];
+
+        parent->node.prefixes[index] = right->prefixes[0];
+        parent->node.keys[index] = right->keys[0];
+
+        INNER(right)->children[0] = INNER(right)->children[1];
+        moveKeys(right, 1, 0, right->count - 1);
+    }
+
+    child->count++;
+    right->count--;
+
+}
+
+/** Merges the child after the separator into the one before it */
+static void mergeChildren(struct inner *parent, unsigned int index) {
+
+    struct node *left = parent->children[index];
+    struct node *right = parent->children[index + 1];
+
+    if (left->leaf) {
+        copyKeys(left, left->count, right, 0, right->count);
+        left->count += right->count;
+        LEAF(left)->next = LEAF(right)->next;
+
+        free(parent->node.keys[index]);
+    } else {
+        left->prefixes[left->count] = parent->node.prefixes[index];
+        left->keys[left->count] = parent->node.keys[index];
+        INNER(left)->children[left->count + 1] = INNER(right)->children[0];
+
+        copyKeys(left, left->count + 1, right, 0, right->count);
+        left->count += right->count + 1;
+    }
+
+    free(right);
+
+    moveKeys(&parent->node, index + 1, index, parent->node.count - index - 1);
+    parent->node.count--;
+
+}
+
+static struct leaf *findLeaf(Private *private, const char *key, uint64_t prefix) {
+
+    struct node *node = private->root;
+    while (!node->leaf)
+        node = INNER(node)->children[searchNode(node, key, prefix, true)];
+
+    return LEAF(node);
+
+}
+
+/** Calls the callback for the keys from the first one (inclusive, NULL for the least key) to the second one (exclusive, NULL for none) until it returns false */
+extern void __CComp_BTreeMap_rangeScan
+            (void *_this, char *from, char *to, EntryCallback callback, void *context) {
+
+    Private *private = (Private *) this->_private;
+
+    struct leaf *leaf;
+    unsigned int index = 0;
+    if (from) {
+        uint64_t prefix = prefixOf(from);
+        leaf = findLeaf(private, from, prefix);
+        index = searchNode(&leaf->node, from, prefix, false);
+    } else {
+        struct node *node = private->root;
+        while (!node->leaf)
+            node = INNER(node)->children[0];
+        leaf = LEAF(node);
+    }
+
+    uint64_t toPrefix = to ? prefixOf(to) : 0;
+    for (; leaf; leaf = leaf->next, index = 0) {
+        for (; index < leaf->node.count; index++) {
+            if (to && compareKeys(leaf->node.prefixes[index], leaf->node.keys[index], toPrefix, to) >= 0)
+                return;
+
+            if (!callback(leaf->node.keys[index], leaf->values[index], context))
+                return;
+        }
+    }
+
+}
+
+/** Returns the least key or NULL if the map is empty */
+extern char *__CComp_BTreeMap_firstKey(void *_this) {
+
+    struct node *node = ((Private *) this->_private)->root;
+    while (!node->leaf)
+        node = INNER(node)->children[0];
+
+    return node->count ? node->keys[0] : NULL;
+
+}
+
+/** Returns the greatest key or NULL if the map is empty */
+extern char *__CComp_BTreeMap_lastKey(void *_this) {
+
+    struct node *node = ((Private *) this->_private)->root;
+    while (!node->leaf)
+        node = INNER(node)->children[node->count];
+
+    return node->count ? node->keys[node->count - 1] : NULL;
+
+}
+
+/** Descends from the root making sure every node on the way can lose a key without underflowing */
+extern void __CComp_BTreeMap_implMap_remove(void *_this, char *key) {
+
+    Private *private = (Private *) this->_private;
+    uint64_t prefix = prefixOf(key);
+
+    struct node *node = private->root;
+    while (!node->leaf) {
+        struct inner *parent = INNER(node);
+        unsigned int index = searchNode(node, key, prefix, true);
+
+        if (parent->children[index]->count <= MIN_KEYS) {
+            if (index && parent->children[index - 1]->count > MIN_KEYS)
+                borrowLeft(parent, index);
+            else if (index < node->count && parent->children[index + 1]->count > MIN_KEYS)
+                borrowRight(parent, index);
+            else {
+                if (index)
+                    index--;
+                mergeChildren(parent, index);
+            }
+        }
+
+        node = parent->children[index];
+
+        // The root lost its last separator to a merge
+        if (!parent->node.count) {
+            private->root = node;
+            free(parent);
+        }
+    }
+
+    unsigned int index = searchNode(node, key, prefix, false);
+    if (index == node->count || compareKeys(node->prefixes[index], node->keys[index], prefix, key))
+        return;
+
+    free(node->keys[index]);
+    moveKeys(node, index + 1, index, node->count - index - 1);
+    node->count--;
+
+    private->mapSize--;
+
+}
+
+/** Descends from the root splitting every full node on the way, so that a split never has to go back up */
+extern void __CComp_BTreeMap_implMap_set(void *_this, char *key, void *value) {
+
+    Private *private = (Private *) this->_private;
+    uint64_t prefix = prefixOf(key);
+
+    if (private->root->count == NODE_KEYS) {
+        struct inner *root = allocateNode(sizeof(struct inner), false);
+        root->children[0] = private->root;
+        splitChild(root, 0);
+        private->root = &root->node;
+    }
+
+    struct node *node = private->root;
+    while (!node->leaf) {
+        unsigned int index = searchNode(node, key, prefix, true);
+
+        if (INNER(node)->children[index]->count == NODE_KEYS) {
+            splitChild(INNER(node), index);
+            if (compareKeys(prefix, key, node->prefixes[index], node->keys[index]) >= 0)
+                index++;
+        }
+
+        node = INNER(node)->children[index];
+    }
+
+    unsigned int index = searchNode(node, key, prefix, false);
+    if (index < node->count && !compareKeys(node->prefixes[index], node->keys[index], prefix, key)) {
+        LEAF(node)->values[index] = value;
+        return;
+    }
+
+    moveKeys(node, index, index + 1, node->count - index);
+    node->prefixes[index] = prefix;
+    node->keys[index] = copyKey(key);
+    LEAF(node)->values[index] = value;
+    node->count++;
+
+    private->mapSize++;
+
+}
+
+extern void *__CComp_BTreeMap_implMap_get(void *_this, char *key) {
+
+    uint64_t prefix = prefixOf(key);
+    struct leaf *leaf = findLeaf((Private *) this->_private, key, prefix);
+
+    unsigned int index = searchNode(&leaf->node, key, prefix, false);
+    if (index == leaf->node.count ||
+        compareKeys(leaf->node.prefixes[index], leaf->node.keys[index], prefix, key))
+        return NULL;
+
+    return leaf->values[index];
+
+}
+
+extern unsigned long int __CComp_BTreeMap_implMap_length(void *_this) {
+
+    return ((Private *) this->_private)->mapSize;
+}
+
+/** Walks the leaves in key order */
+extern void __CComp_BTreeMap_implMap_forEachEntry(void *_this, EntryCallback callback, void *context) {
+
+    __CComp_BTreeMap_rangeScan(_this, NULL, NULL, callback, context);
+
+}
+
+/** cursor is the current leaf and index the position in it to look at next */
+static bool iteratorNext(MapIterator *iterator) {
+
+    struct leaf *leaf = (struct leaf *) iterator->cursor;
+    while (leaf && iterator->index >= leaf->node.count) {
+        leaf = leaf->next;
+        iterator->index = 0;
+    }
+
+    iterator->cursor = leaf;
+    if (!leaf)
+        return false;
+
+    iterator->key = leaf->node.keys[iterator->index];
+    iterator->value = leaf->values[iterator->index++];
+    return true;
+
+}
+
+extern MapIterator __CComp_BTreeMap_implMap_iterator(void *_this) {
+
+    struct node *node = ((Private *) this->_private)->root;
+    while (!node->leaf)
+        node = INNER(node)->children[0];
+
+    MapIterator iterator = { this, LEAF(node), 0, &iteratorNext, NULL, NULL };
+    return iterator;
+
+}
+
+extern String *__CComp_BTreeMap_implObject_toString(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    struct node *node = private->root;
+    while (!node->leaf)
+        node = INNER(node)->children[0];
+
+    String *result = CreateString("BTreeMap: [ ");
+    for (struct leaf *leaf = LEAF(node); leaf; leaf = leaf->next) {
+        for (unsigned int index = 0; index < leaf->node.count; index++) {
+            result->class->add(result, leaf->node.keys[index]);
+            result->class->add(result, ":");
+            result->class->addULong(result, (unsigned long) leaf->values[index]);
+            if (leaf->next || index != leaf->node.count - 1)
+                result->class->add(result, ", ");
+        }
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, private->mapSize);
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+/** Clones the subtree in key order, linking every cloned leaf to the one cloned before it */
+static struct node *copyNode(struct node *node, struct leaf **lastLeaf) {
+
+    struct node *result = allocateNode(node->leaf ? sizeof(struct leaf) : sizeof(struct inner), node->leaf);
+    memcpy(result->prefixes, node->prefixes, node->count * sizeof(uint64_t));
+    for (unsigned int index = 0; index < node->count; index++)
+        result->keys[index] = copyKey(node->keys[index]);
+    result->count = node->count;
+
+    if (node->leaf) {
+        memcpy(LEAF(result)->values, LEAF(node)->values, node->count * sizeof(void *));
+        LEAF(result)->next = NULL;
+
+        if (*lastLeaf)
+            (*lastLeaf)->next = LEAF(result);
+        *lastLeaf = LEAF(result);
+    } else {
+        for (unsigned int index = 0; index <= node->count; index++)
+            INNER(result)->children[index] = copyNode(INNER(node)->children[index], lastLeaf);
+    }
+
+    return result;
+
+}
+
+extern void *__CComp_BTreeMap_implObject_copy(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    BTreeMap *newMap = createBTreeMap();
+    Private *newPrivate = (Private *) newMap->_private;
+
+    struct leaf *lastLeaf = NULL;
+    free(newPrivate->root);
+    newPrivate->root = copyNode(private->root, &lastLeaf);
+    newPrivate->mapSize = private->mapSize;
+
+    return newMap;
+
+}
+
+extern BTreeMap *createBTreeMap() {
+
+    BTreeMap *newMap = (BTreeMap *) malloc(sizeof(BTreeMap));
+    Private *private = (Private *) malloc(sizeof(Private));
+
+    private->root = allocateNode(sizeof(struct leaf), true);
+    LEAF(private->root)->next = NULL;
+    private->mapSize = 0;
+
+    newMap->_private = private;
+    newMap->class = &ClassBTreeMap;
+    newMap->_class = &classBTreeMap;
+
+    return newMap;
+
+}
+
+static void deleteNode(struct node *node) {
+
+    for (unsigned int index = 0; index < node->count; index++)
+        free(node->keys[index]);
+
+    if (!node->leaf)
+        for (unsigned int index = 0; index <= node->count; index++)
+            deleteNode(INNER(node)->children[index]);
+
+    free(node);
+
+}
+
+extern void __CComp_Cls_BTreeMap_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    deleteNode(private->root);
+    free(private);
+    free(this);
+
+}
+
+ClassBTreeMapType ClassBTreeMap = {
+    &__CComp_BTreeMap_rangeScan,
+    &__CComp_BTreeMap_firstKey,
+    &__CComp_BTreeMap_lastKey,
+    {
+        INTERFACE_MAP,
+        &__CComp_BTreeMap_implMap_remove,
+        &__CComp_BTreeMap_implMap_set,
+        &__CComp_BTreeMap_implMap_get,
+        &__CComp_BTreeMap_implMap_length,
+        &__CComp_BTreeMap_implMap_forEachEntry,
+        &__CComp_BTreeMap_implMap_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_BTreeMap_implObject_toString,
+            &__CComp_BTreeMap_implObject_copy
+        }
+    }
+};
+
+Class classBTreeMap = {
+    .classType = CLASS_BTREE_MAP,
+    .delete    = &__CComp_Cls_BTreeMap_delete
+};
@@ -10,6 +10,7 @@ extern "C" {
 #endif /* __cplusplus */
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "foreach.h"
 
@@ -26,6 +27,18 @@ typedef enum _ccomp_classtype {
     CLASS_LINKED_LIST,
     CLASS_ARRAY_MAP,
     CLASS_STRING,
+    // New classes are added at the end so that the values above do not change
+    CLASS_ARRAY_LIST_OF,
+    CLASS_ARRAY_DEQUE,
+    CLASS_UNROLLED_LIST,
+    CLASS_SKIP_LIST,
+    CLASS_CONCURRENT_QUEUE,
+    CLASS_SPSC_QUEUE,
+    CLASS_HASH_MAP,
+    CLASS_SORTED_ARRAY_MAP,
+    CLASS_BTREE_MAP,
+    CLASS_FROZEN_MAP,
+    CLASS_LRU_CACHE,
 } ClassType;
 
 typedef struct _ccomp_class {
@@ -35,6 +48,15 @@ typedef struct _ccomp_class {
 
 typedef void * v_private;
 
+/** Returns a negative, zero or positive value like strcmp does */
+typedef int (*Comparator)(void *, void *);
+
+/** Receives a map entry and the context given along with it, returning false stops the walk */
+typedef bool (*EntryCallback)(char *key, void *value, void *context);
+
+/** Receives an entry evicted from a cache, the key is a copy owned by the cache that is released once the callback returns */
+typedef void (*EvictionCallback)(char *key, void *value, void *context);
+
 /**
  * Interfaces pre-declaration
  */
@@ -42,6 +64,8 @@ typedef void * v_private;
 typedef struct _ccomp_object CCObject; // For case library user will reserves name Object
 typedef struct _ccomp_list List;
 typedef struct _ccomp_map Map;
+typedef struct _ccomp_list_iterator ListIterator;
+typedef struct _ccomp_map_iterator MapIterator;
 
 /**
  * Classes pre-declaration
@@ -49,10 +73,32 @@ typedef struct _ccomp_map Map;
 
 typedef struct _ccomp_array_list_class ClassArrayListType;
 typedef struct _ccomp_array_list ArrayList;
+typedef struct _ccomp_array_list_of_class ClassArrayListOfType;
+typedef struct _ccomp_array_list_of ArrayListOf;
 typedef struct _ccomp_linked_list_class ClassLinkedListType;
 typedef struct _ccomp_linked_list LinkedList;
+typedef struct _ccomp_array_deque_class ClassArrayDequeType;
+typedef struct _ccomp_array_deque ArrayDeque;
+typedef struct _ccomp_unrolled_list_class ClassUnrolledListType;
+typedef struct _ccomp_unrolled_list UnrolledList;
+typedef struct _ccomp_skip_list_class ClassSkipListType;
+typedef struct _ccomp_skip_list SkipList;
+typedef struct _ccomp_concurrent_queue_class ClassConcurrentQueueType;
+typedef struct _ccomp_concurrent_queue ConcurrentQueue;
+typedef struct _ccomp_spsc_queue_class ClassSpscQueueType;
+typedef struct _ccomp_spsc_queue SpscQueue;
 typedef struct _ccomp_array_map_class ClassArrayMapType;
 typedef struct _ccomp_array_map ArrayMap;
+typedef struct _ccomp_hash_map_class ClassHashMapType;
+typedef struct _ccomp_hash_map HashMap;
+typedef struct _ccomp_sorted_array_map_class ClassSortedArrayMapType;
+typedef struct _ccomp_sorted_array_map SortedArrayMap;
+typedef struct _ccomp_btree_map_class ClassBTreeMapType;
+typedef struct _ccomp_btree_map BTreeMap;
+typedef struct _ccomp_frozen_map_class ClassFrozenMapType;
+typedef struct _ccomp_frozen_map FrozenMap;
+typedef struct _ccomp_lru_cache_class ClassLRUCacheType;
+typedef struct _ccomp_lru_cache LRUCache;
 typedef struct _ccomp_string_class ClassStringType;
 typedef struct _ccomp_string String;
 
@@ -62,6 +108,25 @@ struct _ccomp_object {
     void *(*copy)(void *this);
 };
 
+/**
+ * Walks a list from its first element, is returned by value and needs no releasing.
+ * Changing the list other than through the iterator's remove invalidates it.
+ */
+struct _ccomp_list_iterator {
+    void *list;
+    /** Position of the iterator, its meaning depends on the list class */
+    void *cursor;
+    unsigned long int index;
+
+    bool (*hasNext)(ListIterator *this);
+    void *(*next)(ListIterator *this);
+    /**
+     * Removes the element returned by the last call of next. Calling it before
+     * the first next, or twice without a next in between, is undefined.
+     */
+    void (*remove)(ListIterator *this);
+};
+
 struct _ccomp_list {
     ClassType interfaceType;
     void (*add)(void *this, void *value);
@@ -69,16 +134,37 @@ struct _ccomp_list {
     void (*set)(void *this, unsigned long int index, void *value);
     void *(*get)(void *this, unsigned long int index);
     unsigned long int (*length)(void *this);
+    ListIterator (*iterator)(void *this);
 
     CCObject _impl_CCObject;
 };
 
+/**
+ * Walks the entries of a map, is returned by value and needs no releasing.
+ * Changing the map while walking it invalidates the iterator.
+ */
+struct _ccomp_map_iterator {
+    void *map;
+    /** Position of the iterator, its meaning depends on the map class */
+    void *cursor;
+    unsigned long int index;
+
+    /** Moves to the next entry, returns false once there is none left */
+    bool (*next)(MapIterator *this);
+    /** The entry the last call of next moved to, the key is owned by the map */
+    char *key;
+    void *value;
+};
+
 struct _ccomp_map {
     ClassType interfaceType;
     void (*remove)(void *this, char *key);
     void (*set)(void *this, char *key, void *value);
     void *(*get)(void *this, char *_value);
     unsigned long int (*length)(void *this);
+    /** Calls the callback for every entry until it returns false */
+    void (*forEachEntry)(void *this, EntryCallback callback, void *context);
+    MapIterator (*iterator)(void *this);
 
     CCObject _impl_CCObject;
 };
@@ -92,6 +178,22 @@ extern ClassArrayListType ClassArrayList;
 
 struct _ccomp_array_list_class {
     void (*include)(void *this, void **, unsigned long int);
+    void (*insertAt)(void *this, unsigned long int, void *);
+    void (*insertRange)(void *this, unsigned long int, void **, unsigned long int);
+    /** Removes elements from the first index (inclusive) to the second one (exclusive) */
+    void (*removeRange)(void *this, unsigned long int, unsigned long int);
+    void (*truncate)(void *this, unsigned long int);
+    void (*clear)(void *this);
+    void (*swapRemove)(void *this, unsigned long int);
+    void *(*pop)(void *this);
+    void (*sort)(void *this, Comparator);
+    void (*parallelSort)(void *this, Comparator, unsigned int);
+    long int (*binarySearch)(void *this, void *, Comparator);
+    unsigned long int (*insertSorted)(void *this, void *, Comparator);
+    /** Makes room for at least the given count of elements without further reallocation */
+    void (*reserve)(void *this, unsigned long int);
+    unsigned long int (*capacity)(void *this);
+    void (*shrinkToFit)(void *this);
 
     List _impl_List;
 };
@@ -109,8 +211,51 @@ extern ArrayList *createArrayList();
 #endif /* CreateArrayList */
 #define CreateArrayList createArrayList
 
+/**
+ * ArrayListOf
+ *
+ * Stores fixed-size records contiguously instead of pointers to them.
+ * The List methods take and return pointers to records: add and set copy
+ * the record in, get returns a pointer to the stored one. Pointers to
+ * records are invalidated by any operation that grows the list.
+ */
+
+extern Class classArrayListOf;
+extern ClassArrayListOfType ClassArrayListOf;
+
+struct _ccomp_array_list_of_class {
+    void *(*at)(void *this, unsigned long int);
+    void *(*push)(void *this, void *);
+    bool (*pop)(void *this, void *);
+    void (*pushRange)(void *this, void *, unsigned long int);
+    void (*copyRange)(void *this, unsigned long int, unsigned long int, void *);
+    size_t (*elementSize)(void *this);
+    void (*reserve)(void *this, unsigned long int);
+    unsigned long int (*capacity)(void *this);
+    void (*shrinkToFit)(void *this);
+
+    List _impl_List;
+};
+
+struct _ccomp_array_list_of {
+    Class *_class;
+    ClassArrayListOfType *class;
+    v_private _private;
+};
+
+extern ArrayListOf *createArrayListOf(size_t);
+
+#ifdef CreateArrayListOf
+#error Macro CreateArrayListOf already defined
+#endif /* CreateArrayListOf */
+#define CreateArrayListOf createArrayListOf
+
 /**
  * LinkedList
+ *
+ * splice, splitAt and moveRange relink entries without copying them. Each
+ * list recycles the entries removed from it on its own, and the storage of
+ * entries that moved between lists is freed with the last of them.
  */
 
 extern Class classLinkedList;
@@ -122,6 +267,12 @@ struct _ccomp_linked_list_class {
     void *(*getLast)(void *this);
     void (*removeFirst)(void *this);
     void (*removeLast)(void *this);
+    /** Appends all entries of the other list to this one, leaving the other empty */
+    void (*splice)(void *this, LinkedList *);
+    LinkedList *(*splitAt)(void *this, unsigned long int);
+    /** Moves entries from the first index (inclusive) to the second one (exclusive) to the end of the target */
+    void (*moveRange)(void *this, unsigned long int, unsigned long int, LinkedList *);
+    void (*sort)(void *this, Comparator);
 
     List _impl_List;
 };
@@ -139,6 +290,168 @@ extern LinkedList *createLinkedList();
 #endif /* CreateLinkedList */
 #define CreateLinkedList createLinkedList
 
+/**
+ * ArrayDeque
+ *
+ * A List backed by a growable ring buffer: O(1) at both ends and
+ * indexed access, with the same end operations as LinkedList.
+ */
+
+extern Class classArrayDeque;
+extern ClassArrayDequeType ClassArrayDeque;
+
+struct _ccomp_array_deque_class {
+    void (*addFirst)(void *this, void *);
+    void *(*getFirst)(void *this);
+    void *(*getLast)(void *this);
+    void (*removeFirst)(void *this);
+    void (*removeLast)(void *this);
+
+    List _impl_List;
+};
+
+struct _ccomp_array_deque {
+    Class *_class;
+    ClassArrayDequeType *class;
+    v_private _private;
+};
+
+extern ArrayDeque *createArrayDeque();
+
+#ifdef CreateArrayDeque
+#error Macro CreateArrayDeque already defined
+#endif /* CreateArrayDeque */
+#define CreateArrayDeque createArrayDeque
+
+/**
+ * UnrolledList
+ *
+ * A linked list of nodes that hold up to 32 values each, with the same
+ * operations as LinkedList.
+ */
+
+extern Class classUnrolledList;
+extern ClassUnrolledListType ClassUnrolledList;
+
+struct _ccomp_unrolled_list_class {
+    void (*addFirst)(void *this, void *);
+    void *(*getFirst)(void *this);
+    void *(*getLast)(void *this);
+    void (*removeFirst)(void *this);
+    void (*removeLast)(void *this);
+
+    List _impl_List;
+};
+
+struct _ccomp_unrolled_list {
+    Class *_class;
+    ClassUnrolledListType *class;
+    v_private _private;
+};
+
+extern UnrolledList *createUnrolledList();
+
+#ifdef CreateUnrolledList
+#error Macro CreateUnrolledList already defined
+#endif /* CreateUnrolledList */
+#define CreateUnrolledList createUnrolledList
+
+/**
+ * SkipList
+ *
+ * An indexable skip list: insertAt and the indexed List methods take
+ * O(log n). insertSorted and lowerBound keep it ordered by a comparator.
+ */
+
+extern Class classSkipList;
+extern ClassSkipListType ClassSkipList;
+
+struct _ccomp_skip_list_class {
+    void (*insertAt)(void *this, unsigned long int, void *);
+    unsigned long int (*insertSorted)(void *this, void *, Comparator);
+    unsigned long int (*lowerBound)(void *this, void *, Comparator);
+
+    List _impl_List;
+};
+
+struct _ccomp_skip_list {
+    Class *_class;
+    ClassSkipListType *class;
+    v_private _private;
+};
+
+extern SkipList *createSkipList();
+
+#ifdef CreateSkipList
+#error Macro CreateSkipList already defined
+#endif /* CreateSkipList */
+#define CreateSkipList createSkipList
+
+/**
+ * ConcurrentQueue
+ *
+ * An unbounded lock-free FIFO queue for any number of producer and consumer
+ * threads. Polled entries are reclaimed through hazard pointers. poll
+ * returns NULL if the queue is empty, so NULL should not be offered.
+ */
+
+extern Class classConcurrentQueue;
+extern ClassConcurrentQueueType ClassConcurrentQueue;
+
+struct _ccomp_concurrent_queue_class {
+    bool (*offer)(void *this, void *);
+    void *(*poll)(void *this);
+    unsigned long int (*size)(void *this);
+
+    CCObject _impl_CCObject;
+};
+
+struct _ccomp_concurrent_queue {
+    Class *_class;
+    ClassConcurrentQueueType *class;
+    v_private _private;
+};
+
+extern ConcurrentQueue *createConcurrentQueue();
+
+#ifdef CreateConcurrentQueue
+#error Macro CreateConcurrentQueue already defined
+#endif /* CreateConcurrentQueue */
+#define CreateConcurrentQueue createConcurrentQueue
+
+/**
+ * SpscQueue
+ *
+ * A bounded lock-free FIFO ring for exactly one producer and one consumer
+ * thread. offer returns false if the queue is full, poll returns NULL if
+ * it is empty.
+ */
+
+extern Class classSpscQueue;
+extern ClassSpscQueueType ClassSpscQueue;
+
+struct _ccomp_spsc_queue_class {
+    bool (*offer)(void *this, void *);
+    void *(*poll)(void *this);
+    unsigned long int (*size)(void *this);
+    unsigned long int (*capacity)(void *this);
+
+    CCObject _impl_CCObject;
+};
+
+struct _ccomp_spsc_queue {
+    Class *_class;
+    ClassSpscQueueType *class;
+    v_private _private;
+};
+
+extern SpscQueue *createSpscQueue(unsigned long int capacity);
+
+#ifdef CreateSpscQueue
+#error Macro CreateSpscQueue already defined
+#endif /* CreateSpscQueue */
+#define CreateSpscQueue createSpscQueue
+
 /**
  * ArrayMap
  */
@@ -147,6 +460,8 @@ extern Class classArrayMap;
 extern ClassArrayMapType ClassArrayMap;
 
 struct _ccomp_array_map_class {
+    FrozenMap *(*freeze)(void *this);
+
     Map _impl_Map;
 };
 
@@ -163,6 +478,175 @@ extern ArrayMap *createArrayMap();
 #endif /* CreateArrayMap */
 #define CreateArrayMap createArrayMap
 
+/**
+ * HashMap
+ *
+ * An open-addressing hash table with the same interface as ArrayMap and
+ * O(1) expected lookups. Keys are copied in.
+ */
+
+extern Class classHashMap;
+extern ClassHashMapType ClassHashMap;
+
+struct _ccomp_hash_map_class {
+    /** Makes room for at least the given count of entries without rehashing */
+    void (*reserve)(void *this, unsigned long int);
+
+    Map _impl_Map;
+};
+
+struct _ccomp_hash_map {
+    Class *_class;
+    ClassHashMapType *class;
+    v_private _private;
+};
+
+extern HashMap *createHashMap();
+
+#ifdef CreateHashMap
+#error Macro CreateHashMap already defined
+#endif /* CreateHashMap */
+#define CreateHashMap createHashMap
+
+/**
+ * SortedArrayMap
+ *
+ * Keeps the entries sorted by key (in strcmp order) in contiguous arrays,
+ * for maps that are built once and then mostly read. Lookups take
+ * O(log n), set and remove move the entries after the key. Keys returned
+ * by floorKey, ceilingKey and keyAt belong to the map and are valid until
+ * it is modified.
+ */
+
+extern Class classSortedArrayMap;
+extern ClassSortedArrayMapType ClassSortedArrayMap;
+
+struct _ccomp_sorted_array_map_class {
+    void (*buildFrom)(void *this, char **, void **, unsigned long int);
+    char *(*floorKey)(void *this, char *);
+    char *(*ceilingKey)(void *this, char *);
+    /** Entries are indexed in key order, from 0 to the length of the map */
+    char *(*keyAt)(void *this, unsigned long int);
+    void *(*valueAt)(void *this, unsigned long int);
+
+    Map _impl_Map;
+};
+
+struct _ccomp_sorted_array_map {
+    Class *_class;
+    ClassSortedArrayMapType *class;
+    v_private _private;
+};
+
+extern SortedArrayMap *createSortedArrayMap();
+
+#ifdef CreateSortedArrayMap
+#error Macro CreateSortedArrayMap already defined
+#endif /* CreateSortedArrayMap */
+#define CreateSortedArrayMap createSortedArrayMap
+
+/**
+ * BTreeMap
+ *
+ * A B+-tree ordered by key (in strcmp order) with cache-line aligned nodes
+ * of 32 keys. Lookups and updates take O(log n), and rangeScan walks the
+ * linked leaves. Keys passed to callbacks or returned by firstKey and
+ * lastKey belong to the map and are valid until it is modified.
+ */
+
+extern Class classBTreeMap;
+extern ClassBTreeMapType ClassBTreeMap;
+
+struct _ccomp_btree_map_class {
+    /** Visits keys from the first one (inclusive) to the second one (exclusive), NULL means unbounded */
+    void (*rangeScan)(void *this, char *, char *, EntryCallback, void *);
+    char *(*firstKey)(void *this);
+    char *(*lastKey)(void *this);
+
+    Map _impl_Map;
+};
+
+struct _ccomp_btree_map {
+    Class *_class;
+    ClassBTreeMapType *class;
+    v_private _private;
+};
+
+extern BTreeMap *createBTreeMap();
+
+#ifdef CreateBTreeMap
+#error Macro CreateBTreeMap already defined
+#endif /* CreateBTreeMap */
+#define CreateBTreeMap createBTreeMap
+
+/**
+ * FrozenMap
+ *
+ * An immutable map built once from all of its entries, usually through
+ * ArrayMap's freeze. A minimal perfect hash gives every key its own slot,
+ * so a lookup reads exactly one slot. Keys are packed into one block;
+ * set and remove do nothing.
+ */
+
+extern Class classFrozenMap;
+extern ClassFrozenMapType ClassFrozenMap;
+
+struct _ccomp_frozen_map_class {
+    Map _impl_Map;
+};
+
+struct _ccomp_frozen_map {
+    Class *_class;
+    ClassFrozenMapType *class;
+    v_private _private;
+};
+
+extern FrozenMap *createFrozenMap(char **keys, void **values, unsigned long int count);
+
+#ifdef CreateFrozenMap
+#error Macro CreateFrozenMap already defined
+#endif /* CreateFrozenMap */
+#define CreateFrozenMap createFrozenMap
+
+/**
+ * LRUCache
+ *
+ * A map holding at most capacity entries. get moves the entry to the front,
+ * set puts an entry at the front and evicts the least recently used ones while
+ * the cache is over capacity. The eviction callback may use the cache. Both
+ * are O(1): a HashMap finds the entries, which are linked from the most to the
+ * least recently used. Keys are copied in.
+ */
+
+extern Class classLRUCache;
+extern ClassLRUCacheType ClassLRUCache;
+
+struct _ccomp_lru_cache_class {
+    /** Looks up a key like get does, but neither moves the entry nor counts the lookup */
+    void *(*peek)(void *this, char *);
+    unsigned long int (*capacity)(void *this);
+    /** Lookups through get that found their key */
+    unsigned long int (*hits)(void *this);
+    /** Lookups through get that did not */
+    unsigned long int (*misses)(void *this);
+
+    Map _impl_Map;
+};
+
+struct _ccomp_lru_cache {
+    Class *_class;
+    ClassLRUCacheType *class;
+    v_private _private;
+};
+
+/** The callback may be NULL, it is called for evicted entries only and not for removed ones */
+extern LRUCache *createLRUCache(unsigned long int capacity, EvictionCallback onEvict, void *context);
+
+#ifdef CreateLRUCache
+#error Macro CreateLRUCache already defined
+#endif /* CreateLRUCache */
+#define CreateLRUCache createLRUCache
+
 /**
  * String
  */
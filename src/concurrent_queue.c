@@ -0,0 +1,402 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "ccomponents.h"
+
+#define this ((ConcurrentQueue *) _this)
+
+#define CACHE_LINE 64
+#define HAZARDS_PER_THREAD 2
+/** A thread scans for reclaimable nodes once it has retired this many */
+#define RETIRE_THRESHOLD 64
+
+struct node {
+    void *value;
+    _Atomic(struct node *) next;
+    /** Set once a poll moved the head past the node */
+    atomic_bool dequeued;
+    struct node *retiredNext;
+};
+
+/**
+ * Michael-Scott queue: head points to a sentinel whose successor holds the
+ * first value. Head, tail and the size counter sit on separate cache lines.
+ */
+typedef struct _queue_private {
+    _Alignas(CACHE_LINE) _Atomic(struct node *) head;
+    _Alignas(CACHE_LINE) _Atomic(struct node *) tail;
+    _Alignas(CACHE_LINE) atomic_long queueSize;
+} Private;
+
+/**
+ * Hazard pointers shared by all queues. Every thread owns a record for as
+ * long as it lives; a record released on thread exit is reused by the next
+ * thread together with the nodes it still has to reclaim.
+ */
+struct hazardRecord {
+    _Atomic(struct node *) hazards[HAZARDS_PER_THREAD];
+    atomic_bool active;
+    struct hazardRecord *next;
+    struct node *retired;
+    unsigned long retiredCount;
+};
+
+static _Atomic(struct hazardRecord *) hazardRecords;
+static _Thread_local struct hazardRecord *threadRecord;
+static pthread_key_t recordKey;
+static pthread_once_t recordKeyOnce = PTHREAD_ONCE_INIT;
+
+static void releaseRecord(void *argument) {
+
+    struct hazardRecord *record = (struct hazardRecord *) argument;
+    for (int index = 0; index < HAZARDS_PER_THREAD; index++)
+        atomic_store(&record->hazards[index], NULL);
+
+    atomic_store(&record->active, false);
+
+}
+
+static void createRecordKey(void) {
+
+    pthread_key_create(&recordKey, &releaseRecord);
+}
+
+static struct hazardRecord *getRecord(void) {
+
+    if (threadRecord)
+        return threadRecord;
+
+    struct hazardRecord *record = atomic_load(&hazardRecords);
+    for (; record; record = record->next) {
+        bool expected = false;
+        if (!atomic_load(&record->active) &&
+            atomic_compare_exchange_strong(&record->active, &expected, true))
+            break;
+    }
+
+    if (!record) {
+        record = (struct hazardRecord *) calloc(1, sizeof(struct hazardRecord));
+        atomic_init(&record->active, true);
+
+        struct hazardRecord *head = atomic_load(&hazardRecords);
+        do {
+            record->next = head;
+        } while (!atomic_compare_exchange_weak(&hazardRecords, &head, record));
+    }
+
+    pthread_once(&recordKeyOnce, &createRecordKey);
+    pthread_setspecific(recordKey, record);
+
+    return threadRecord = record;
+
+}
+
+static int compareNodes(const void *a, const void *b) {
+
+    uintptr_t left = (uintptr_t) *(struct node * const *) a;
+    uintptr_t right = (uintptr_t) *(struct node * const *) b;
+
+    return (left > right) - (left < right);
+}
+
+/** Frees the retired nodes of the record that no thread protects anymore */
+static void scan(struct hazardRecord *record) {
+
+    unsigned long hazardCount = 0, capacity = 16;
+    struct node **hazards = (struct node **) malloc(capacity * sizeof(struct node *));
+
+    for (struct hazardRecord *other = atomic_load(&hazardRecords); other; other = other->next) {
+        for (int index = 0; index < HAZARDS_PER_THREAD; index++) {
+            struct node *hazard = atomic_load(&other->hazards[index]);
+            if (!hazard)
+                continue;
+
+            if (hazardCount == capacity)
+                hazards = (struct node **) realloc(hazards, (capacity <<= 1) * sizeof(struct node *));
+            hazards[hazardCount++] = hazard;
+        }
+    }
+
+    qsort(hazards, hazardCount, sizeof(struct node *), &compareNodes);
+
+    struct node *node = record->retired;
+    record->retired = NULL;
+    record->retiredCount = 0;
+
+    while (node) {
+        struct node *next = node->retiredNext;
+
+        if (bsearch(&node, hazards, hazardCount, sizeof(struct node *), &compareNodes)) {
+            node->retiredNext = record->retired;
+            record->retired = node;
+            record->retiredCount++;
+        } else
+            free(node);
+
+        node = next;
+    }
+
+    free(hazards);
+
+}
+
+static void retire(struct hazardRecord *record, struct node *node) {
+
+    node->retiredNext = record->retired;
+    record->retired = node;
+
+    if (++record->retiredCount >= RETIRE_THRESHOLD)
+        scan(record);
+
+}
+
+/** Publishes the pointer as a hazard and returns it once it is still the one at the source */
+static struct node *protect(struct hazardRecord *record, int index, _Atomic(struct node *) *source) {
+
+    struct node *node = atomic_load(source);
+    for (;;) {
+        atomic_store(&record->hazards[index], node);
+
+        struct node *current = atomic_load(source);
+        if (current == node)
+            return node;
+
+        node = current;
+    }
+
+}
+
+extern bool __CComp_ConcurrentQueue_offer(void *_this, void *value) {
+
+    Private *private = (Private *) this->_private;
+    struct hazardRecord *record = getRecord();
+
+    struct node *node = (struct node *) malloc(sizeof(struct node));
+    node->value = value;
+    atomic_init(&node->next, NULL);
+    atomic_init(&node->dequeued, false);
+
+    for (;;) {
+        struct node *tail = protect(record, 0, &private->tail);
+        struct node *next = atomic_load(&tail->next);
+
+        if (tail != atomic_load(&private->tail))
+            continue;
+
+        if (next) {
+            atomic_compare_exchange_strong(&private->tail, &tail, next);
+            continue;
+        }
+
+        struct node *expected = NULL;
+        if (atomic_compare_exchange_strong(&tail->next, &expected, node)) {
+            atomic_compare_exchange_strong(&private->tail, &tail, node);
+            break;
+        }
+    }
+
+    atomic_store(&record->hazards[0], NULL);
+    atomic_fetch_add(&private->queueSize, 1);
+
+    return true;
+
+}
+
+/** Returns NULL if the queue is empty */
+extern void *__CComp_ConcurrentQueue_poll(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    struct hazardRecord *record = getRecord();
+    void *value = NULL;
+
+    for (;;) {
+        struct node *head = protect(record, 0, &private->head);
+        struct node *tail = atomic_load(&private->tail);
+        struct node *next = protect(record, 1, &head->next);
+
+        if (head != atomic_load(&private->head))
+            continue;
+
+        if (!next)
+            break;
+
+        if (head == tail) {
+            atomic_compare_exchange_strong(&private->tail, &tail, next);
+            continue;
+        }
+
+        value = next->value;
+        if (atomic_compare_exchange_strong(&private->head, &head, next)) {
+            atomic_store(&record->hazards[0], NULL);
+            atomic_store(&record->hazards[1], NULL);
+
+            atomic_store(&head->dequeued, true);
+            retire(record, head);
+            atomic_fetch_sub(&private->queueSize, 1);
+
+            return value;
+        }
+    }
+
+    atomic_store(&record->hazards[0], NULL);
+    atomic_store(&record->hazards[1], NULL);
+
+    return NULL;
+
+}
+
+/** Only a snapshot while other threads offer or poll */
+extern unsigned long int __CComp_ConcurrentQueue_size(void *_this) {
+
+    long int size = atomic_load(&((Private *) this->_private)->queueSize);
+    return size > 0 ? (unsigned long int) size : 0;
+}
+
+/**
+ * Calls the action with every value in the queue while protecting the nodes
+ * like poll does. The two hazards hold the current node and its successor in
+ * turn. As long as the current node is not dequeued, the head has not passed
+ * it, so its successor cannot have been retired before it was protected.
+ * Once a poll dequeued the current node, the walk goes on from the head.
+ */
+static void forEachValue(Private *private, void (*action)(void *value, void *context), void *context) {
+
+    struct hazardRecord *record = getRecord();
+    struct node *cursor = protect(record, 0, &private->head);
+    int slot = 1;
+
+    for (;;) {
+        struct node *next = atomic_load(&cursor->next);
+        atomic_store(&record->hazards[slot], next);
+
+        if (atomic_load(&cursor->dequeued))
+            cursor = protect(record, slot, &private->head);
+        else if (!next)
+            break;
+        else {
+            action(next->value, context);
+            cursor = next;
+        }
+
+        slot ^= 1;
+    }
+
+    atomic_store(&record->hazards[0], NULL);
+    atomic_store(&record->hazards[1], NULL);
+
+}
+
+struct listing {
+    String *result;
+    unsigned long int count;
+};
+
+static void addValue(void *value, void *context) {
+
+    struct listing *listing = (struct listing *) context;
+
+    if (listing->count++)
+        listing->result->class->add(listing->result, ", ");
+    listing->result->class->addULong(listing->result, (unsigned long) value);
+
+}
+
+/** Values polled by other threads meanwhile are left out */
+extern String *__CComp_ConcurrentQueue_implObject_toString(void *_this) {
+
+    String *result = CreateString("ConcurrentQueue: [ ");
+    struct listing listing = { result, 0 };
+    forEachValue((Private *) this->_private, &addValue, &listing);
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, __CComp_ConcurrentQueue_size(this));
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+/** Appends to a queue no other thread uses yet, offer would need the hazards the walk holds */
+static void appendValue(void *value, void *context) {
+
+    Private *private = (Private *) context;
+
+    struct node *node = (struct node *) malloc(sizeof(struct node));
+    node->value = value;
+    atomic_init(&node->next, NULL);
+    atomic_init(&node->dequeued, false);
+
+    atomic_store(&atomic_load(&private->tail)->next, node);
+    atomic_store(&private->tail, node);
+    atomic_fetch_add(&private->queueSize, 1);
+
+}
+
+/** Like toString, leaves out the values polled by other threads meanwhile */
+extern void *__CComp_ConcurrentQueue_implObject_copy(void *_this) {
+
+    ConcurrentQueue *result = createConcurrentQueue();
+    forEachValue((Private *) this->_private, &appendValue, result->_private);
+
+    return result;
+
+}
+
+extern ConcurrentQueue *createConcurrentQueue() {
+
+    ConcurrentQueue *newQueue = (ConcurrentQueue *) malloc(sizeof(ConcurrentQueue));
+    Private *private = (Private *) aligned_alloc(CACHE_LINE, sizeof(Private));
+
+    struct node *sentinel = (struct node *) malloc(sizeof(struct node));
+    atomic_init(&sentinel->next, NULL);
+    atomic_init(&sentinel->dequeued, false);
+
+    atomic_init(&private->head, sentinel);
+    atomic_init(&private->tail, sentinel);
+    atomic_init(&private->queueSize, 0);
+
+    newQueue->_private = private;
+    newQueue->class = &ClassConcurrentQueue;
+    newQueue->_class = &classConcurrentQueue;
+
+    return newQueue;
+
+}
+
+/** No other thread may use the queue anymore */
+extern void __CComp_Cls_ConcurrentQueue_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    struct node *cursor = atomic_load(&private->head);
+    while (cursor) {
+        struct node *next = atomic_load(&cursor->next);
+        free(cursor);
+        cursor = next;
+    }
+
+    if (threadRecord && threadRecord->retired)
+        scan(threadRecord);
+
+    free(private);
+    free(this);
+
+}
+
+ClassConcurrentQueueType ClassConcurrentQueue = {
+    &__CComp_ConcurrentQueue_offer,
+    &__CComp_ConcurrentQueue_poll,
+    &__CComp_ConcurrentQueue_size,
+    {
+        INTERFACE_CCOBJECT,
+        &__CComp_ConcurrentQueue_implObject_toString,
+        &__CComp_ConcurrentQueue_implObject_copy
+    }
+};
+
+Class classConcurrentQueue = {
+    .classType = CLASS_CONCURRENT_QUEUE,
+    .delete    = &__CComp_Cls_ConcurrentQueue_delete
+};
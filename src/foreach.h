@@ -3,12 +3,28 @@
 
 #define List_forEach(__LIST__, __ITEM__, __CODE__)                                      \
         for (                                                                            \
-            unsigned long int __counter_##__ITEM__ = 0;                                   \
-            __counter_##__ITEM__ < __LIST__->class->_impl_List.length(__LIST__);           \
-            __counter_##__ITEM__++)                                                         \
+            ListIterator __iterator_##__ITEM__ =                                          \
+                __LIST__->class->_impl_List.iterator(__LIST__);                            \
+            __iterator_##__ITEM__.hasNext(&__iterator_##__ITEM__);)                         \
         {                                                                                    \
-            void *__ITEM__ = __LIST__->class->_impl_List.get(__LIST__, __counter_##__ITEM__); \
+            void *__ITEM__ = __iterator_##__ITEM__.next(&__iterator_##__ITEM__);              \
             __CODE__                                                                           \
         }
 
+/** Removes the current item of the enclosing List_forEach from its list */
+#define List_forEachRemove(__ITEM__) (__iterator_##__ITEM__.remove(&__iterator_##__ITEM__))
+
+/** Walks the entries of a map, declaring its key as char * and its value as void * */
+#define Map_forEach(__MAP__, __KEY__, __VALUE__, __CODE__)                              \
+        for (                                                                            \
+            MapIterator __iterator_##__KEY__ =                                            \
+                __MAP__->class->_impl_Map.iterator(__MAP__);                               \
+            __iterator_##__KEY__.next(&__iterator_##__KEY__);)                              \
+        {                                                                                    \
+            char *__KEY__ = __iterator_##__KEY__.key;                                         \
+            void *__VALUE__ = __iterator_##__KEY__.value;                                      \
+            (void) __KEY__, (void) __VALUE__;                                                   \
+            __CODE__                                                                            \
+        }
+
 #endif /* __FOREACH_H__ */
\ No newline at end of file
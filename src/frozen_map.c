@@ -0,0 +1,455 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+#include "util/hash.h"
+
+#define this ((FrozenMap *) _this)
+
+/** Average count of keys per bucket */
+#define BUCKET_KEYS 4
+/** A bucket that finds no place with this many first displacements makes the build start over with another seed */
+#define MAX_FIRST_DISPLACEMENT 32
+
+#define NONE ((unsigned long) -1)
+
+/**
+ * CHD minimal perfect hash: a key's hash selects a bucket and two values
+ * f1, f2 below the key count; the bucket's displacement pair places the
+ * key at (f1 + d0 * f2 + d1) mod count. Every slot holds exactly one key.
+ */
+struct displacement {
+    uint32_t d0, d1;
+};
+
+/** The key is a NUL-terminated part of the key blob */
+struct slot {
+    uint32_t offset, length;
+    void *value;
+};
+
+typedef struct _frozen_map_private {
+    struct displacement *displacements;
+    struct slot *slots;
+    char *keys;
+    unsigned long int mapSize;
+    unsigned long int bucketCount;
+    uint64_t seed;
+} Private;
+
+static inline unsigned long bucketOf(uint64_t hash, unsigned long bucketCount) {
+
+    return (unsigned long) (((hash >> 32) * bucketCount) >> 32);
+}
+
+static inline unsigned long firstOf(uint64_t hash, unsigned long count) {
+
+    return (unsigned long) ((uint32_t) hash % count);
+}
+
+static inline unsigned long secondOf(uint64_t hash, unsigned long count) {
+
+    return (unsigned long) ((hash * 0x9E3779B97F4A7C15ULL) >> 32) % count;
+}
+
+/** State of a build, shared by the attempts with different seeds */
+struct build {
+    char **keys;
+    unsigned long *lengths;
+    uint64_t *hashes;
+    /** Indexes of the keys grouped by bucket, of duplicate keys only the last one is kept */
+    unsigned long *members;
+    unsigned long *bucketStarts;
+    unsigned long *bucketOrder;
+    unsigned long count;
+};
+
+/** Groups the keys by bucket, sorts the buckets by size and returns the count of distinct keys */
+static unsigned long groupKeys(struct build *build, Private *private) {
+
+    unsigned long bucketCount = private->bucketCount;
+    unsigned long *bucketStarts = build->bucketStarts;
+    memset(bucketStarts, 0, (bucketCount + 1) * sizeof(unsigned long));
+
+    for (unsigned long index = 0; index < build->count; index++) {
+        build->hashes[index] = _hash_bytes_seeded(build->keys[index], build->lengths[index], private->seed);
+        bucketStarts[bucketOf(build->hashes[index], bucketCount) + 1]++;
+    }
+
+    for (unsigned long bucket = 0; bucket < bucketCount; bucket++)
+        bucketStarts[bucket + 1] += bucketStarts[bucket];
+
+    unsigned long *filled = malloc(bucketCount * sizeof(unsigned long));
+    memcpy(filled, bucketStarts, bucketCount * sizeof(unsigned long));
+
+    unsigned long distinct = build->count;
+    for (unsigned long index = 0; index < build->count; index++) {
+        unsigned long bucket = bucketOf(build->hashes[index], bucketCount);
+
+        for (unsigned long member = bucketStarts[bucket]; member < filled[bucket]; member++) {
+            unsigned long other = build->members[member];
+            if (other != NONE && build->hashes[other] == build->hashes[index] &&
+                build->lengths[other] == build->lengths[index] &&
+                !memcmp(build->keys[other], build->keys[index], build->lengths[index])) {
+                build->members[member] = NONE;
+                distinct--;
+            }
+        }
+
+        build->members[filled[bucket]++] = index;
+    }
+
+    // Counting sort of the buckets by size, the largest ones are placed first
+    unsigned long maxSize = 0;
+    for (unsigned long bucket = 0; bucket < bucketCount; bucket++)
+        if (bucketStarts[bucket + 1] - bucketStarts[bucket] > maxSize)
+            maxSize = bucketStarts[bucket + 1] - bucketStarts[bucket];
+
+    unsigned long *sizeStarts = calloc(maxSize + 2, sizeof(unsigned long));
+    for (unsigned long bucket = 0; bucket < bucketCount; bucket++)
+        sizeStarts[maxSize - (bucketStarts[bucket + 1] - bucketStarts[bucket]) + 1]++;
+
+    for (unsigned long size = 0; size <= maxSize; size++)
+        sizeStarts[size + 1] += sizeStarts[size];
+
+    for (unsigned long bucket = 0; bucket < bucketCount; bucket++)
+        build->bucketOrder[sizeStarts[maxSize - (bucketStarts[bucket + 1] - bucketStarts[bucket])]++] = bucket;
+
+    free(sizeStarts);
+    free(filled);
+
+    return distinct;
+
+}
+
+/** Returns the first free slot from the given one on, or the count of slots if there is none */
+static unsigned long nextFree(uint64_t *taken, unsigned long count, unsigned long from) {
+
+    unsigned long word = from / 64;
+    uint64_t available = ~taken[word] & (~0ULL << (from % 64));
+
+    while (!available) {
+        if (++word * 64 >= count)
+            return count;
+        available = ~taken[word];
+    }
+
+    unsigned long position = word * 64 + (unsigned long) __builtin_ctzll(available);
+    return position < count ? position : count;
+
+}
+
+static inline unsigned long wrap(unsigned long position, unsigned long count) {
+
+    return position >= count ? position - count : position;
+}
+
+/**
+ * Finds displacements for all buckets and stores the key index of every slot,
+ * false if a bucket has no place. For each d0 only the values of d1 that put
+ * the bucket's first key on a free slot are tried.
+ */
+static bool placeBuckets(struct build *build, Private *private, unsigned long *slotKeys) {
+
+    unsigned long count = private->mapSize;
+    uint64_t *taken = calloc((count + 63) / 64, sizeof(uint64_t));
+    unsigned long *positions = malloc(build->count * sizeof(unsigned long));
+    unsigned long *steps = malloc(build->count * sizeof(unsigned long));
+    unsigned long *bases = malloc(build->count * sizeof(unsigned long));
+
+    bool placed = true;
+    for (unsigned long order = 0; order < private->bucketCount && placed; order++) {
+        unsigned long bucket = build->bucketOrder[order];
+        unsigned long *members = build->members + build->bucketStarts[bucket];
+        unsigned long size = build->bucketStarts[bucket + 1] - build->bucketStarts[bucket];
+
+        private->displacements[bucket].d0 = private->displacements[bucket].d1 = 0;
+
+        unsigned long keys = 0;
+        for (unsigned long member = 0; member < size; member++) {
+            if (members[member] == NONE)
+                continue;
+
+            uint64_t hash = build->hashes[members[member]];
+            members[keys] = members[member];
+            positions[keys] = firstOf(hash, count);
+            steps[keys++] = secondOf(hash, count);
+        }
+
+        if (!keys)
+            continue;
+
+        placed = false;
+        for (unsigned long d0 = 0; d0 < MAX_FIRST_DISPLACEMENT && !placed; d0++) {
+            for (unsigned long key = 0; key < keys; key++)
+                bases[key] = (positions[key] + d0 * steps[key]) % count;
+
+            for (unsigned long d1 = 0; d1 < count;) {
+                unsigned long target = wrap(bases[0] + d1, count);
+                unsigned long available = nextFree(taken, count, target);
+                if (available == count)
+                    available = nextFree(taken, count, 0) + count;
+
+                d1 += available - target;
+                if (d1 >= count)
+                    break;
+
+                unsigned long key = 0;
+                for (; key < keys; key++) {
+                    unsigned long position = wrap(bases[key] + d1, count);
+                    if (taken[position / 64] >> (position % 64) & 1)
+                        break;
+
+                    taken[position / 64] |= 1ULL << (position % 64);
+                    slotKeys[position] = members[key];
+                }
+
+                if (key == keys) {
+                    private->displacements[bucket].d0 = (uint32_t) d0;
+                    private->displacements[bucket].d1 = (uint32_t) d1;
+                    placed = true;
+                    break;
+                }
+
+                // Releases the slots this try took
+                while (key--) {
+                    unsigned long position = wrap(bases[key] + d1, count);
+                    taken[position / 64] &= ~(1ULL << (position % 64));
+                }
+
+                d1++;
+            }
+        }
+    }
+
+    free(bases);
+    free(steps);
+    free(positions);
+    free(taken);
+
+    return placed;
+
+}
+
+extern void __CComp_FrozenMap_implMap_remove(void *_this, char *key) {
+
+    // Frozen maps are not modified
+}
+
+extern void __CComp_FrozenMap_implMap_set(void *_this, char *key, void *value) {
+
+    // Frozen maps are not modified
+}
+
+/** Looks at exactly one slot */
+extern void *__CComp_FrozenMap_implMap_get(void *_this, char *key) {
+
+    Private *private = (Private *) this->_private;
+    if (!private->mapSize)
+        return NULL;
+
+    unsigned long length = strlen(key);
+    uint64_t hash = _hash_bytes_seeded(key, length, private->seed);
+    struct displacement displacement = private->displacements[bucketOf(hash, private->bucketCount)];
+
+    struct slot *slot = &private->slots[(firstOf(hash, private->mapSize) +
+        displacement.d0 * secondOf(hash, private->mapSize) + displacement.d1) % private->mapSize];
+
+    if (slot->length != length || memcmp(private->keys + slot->offset, key, length))
+        return NULL;
+
+    return slot->value;
+
+}
+
+extern unsigned long int __CComp_FrozenMap_implMap_length(void *_this) {
+
+    return ((Private *) this->_private)->mapSize;
+}
+
+/** Walks the slots in order, which reads the key blob sequentially */
+extern void __CComp_FrozenMap_implMap_forEachEntry(void *_this, EntryCallback callback, void *context) {
+
+    Private *private = (Private *) this->_private;
+
+    for (unsigned long index = 0; index < private->mapSize; index++)
+        if (!callback(private->keys + private->slots[index].offset, private->slots[index].value, context))
+            return;
+
+}
+
+static bool iteratorNext(MapIterator *iterator) {
+
+    Private *private = (Private *) ((FrozenMap *) iterator->map)->_private;
+    if (iterator->index >= private->mapSize)
+        return false;
+
+    struct slot *slot = &private->slots[iterator->index++];
+    iterator->key = private->keys + slot->offset;
+    iterator->value = slot->value;
+    return true;
+
+}
+
+extern MapIterator __CComp_FrozenMap_implMap_iterator(void *_this) {
+
+    MapIterator iterator = { this, NULL, 0, &iteratorNext, NULL, NULL };
+    return iterator;
+
+}
+
+extern String *__CComp_FrozenMap_implObject_toString(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    String *result = CreateString("FrozenMap: [ ");
+    for (unsigned long index = 0; index < private->mapSize; index++) {
+        result->class->add(result, private->keys + private->slots[index].offset);
+        result->class->add(result, ":");
+        result->class->addULong(result, (unsigned long) private->slots[index].value);
+        if (index != private->mapSize - 1)
+            result->class->add(result, ", ");
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, private->mapSize);
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+static void *duplicate(const void *source, size_t size) {
+
+    return size ? memcpy(malloc(size), source, size) : NULL;
+}
+
+extern void *__CComp_FrozenMap_implObject_copy(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    FrozenMap *newMap = createFrozenMap(NULL, NULL, 0);
+    Private *newPrivate = (Private *) newMap->_private;
+
+    size_t keysSize = 0;
+    if (private->mapSize) {
+        struct slot *last = &private->slots[private->mapSize - 1];
+        keysSize = last->offset + last->length + 1;
+    }
+
+    newPrivate->displacements = duplicate(private->displacements,
+        private->bucketCount * sizeof(struct displacement));
+    newPrivate->slots = duplicate(private->slots, private->mapSize * sizeof(struct slot));
+    newPrivate->keys = duplicate(private->keys, keysSize);
+    newPrivate->mapSize = private->mapSize;
+    newPrivate->bucketCount = private->bucketCount;
+    newPrivate->seed = private->seed;
+
+    return newMap;
+
+}
+
+/** Of equal keys the last one is kept. Returns NULL if the keys take 4 GiB or more */
+extern FrozenMap *createFrozenMap(char **keys, void **values, unsigned long int count) {
+
+    Private *private = (Private *) calloc(1, sizeof(Private));
+
+    if (count) {
+        struct build build = { keys, malloc(count * sizeof(unsigned long)),
+            malloc(count * sizeof(uint64_t)), malloc(count * sizeof(unsigned long)), NULL, NULL, count };
+
+        uint64_t keysSize = 0;
+        for (unsigned long index = 0; index < count; index++) {
+            build.lengths[index] = strlen(keys[index]);
+            keysSize += build.lengths[index] + 1;
+        }
+
+        if (keysSize > UINT32_MAX) {
+            free(build.lengths);
+            free(build.hashes);
+            free(build.members);
+            free(private);
+            return NULL;
+        }
+
+        private->bucketCount = (count + BUCKET_KEYS - 1) / BUCKET_KEYS;
+        build.bucketStarts = malloc((private->bucketCount + 1) * sizeof(unsigned long));
+        build.bucketOrder = malloc(private->bucketCount * sizeof(unsigned long));
+        private->displacements = malloc(private->bucketCount * sizeof(struct displacement));
+
+        unsigned long *slotKeys = NULL;
+        for (;; private->seed++) {
+            private->mapSize = groupKeys(&build, private);
+
+            free(slotKeys);
+            slotKeys = malloc(private->mapSize * sizeof(unsigned long));
+            if (placeBuckets(&build, private, slotKeys))
+                break;
+        }
+
+        // Keys are packed in slot order, so that walking the slots reads the blob sequentially
+        private->slots = malloc(private->mapSize * sizeof(struct slot));
+        private->keys = malloc((size_t) keysSize);
+
+        uint32_t offset = 0;
+        for (unsigned long index = 0; index < private->mapSize; index++) {
+            unsigned long key = slotKeys[index];
+
+            private->slots[index].offset = offset;
+            private->slots[index].length = (uint32_t) build.lengths[key];
+            private->slots[index].value = values[key];
+
+            memcpy(private->keys + offset, keys[key], build.lengths[key] + 1);
+            offset += (uint32_t) build.lengths[key] + 1;
+        }
+
+        free(slotKeys);
+        free(build.lengths);
+        free(build.hashes);
+        free(build.members);
+        free(build.bucketStarts);
+        free(build.bucketOrder);
+    }
+
+    FrozenMap *newMap = (FrozenMap *) malloc(sizeof(FrozenMap));
+    newMap->_private = private;
+    newMap->class = &ClassFrozenMap;
+    newMap->_class = &classFrozenMap;
+
+    return newMap;
+
+}
+
+extern void __CComp_Cls_FrozenMap_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    free(private->displacements);
+    free(private->slots);
+    free(private->keys);
+    free(private);
+    free(this);
+
+}
+
+ClassFrozenMapType ClassFrozenMap = {
+    {
+        INTERFACE_MAP,
+        &__CComp_FrozenMap_implMap_remove,
+        &__CComp_FrozenMap_implMap_set,
+        &__CComp_FrozenMap_implMap_get,
+        &__CComp_FrozenMap_implMap_length,
+        &__CComp_FrozenMap_implMap_forEachEntry,
+        &__CComp_FrozenMap_implMap_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_FrozenMap_implObject_toString,
+            &__CComp_FrozenMap_implObject_copy
+        }
+    }
+};
+
+Class classFrozenMap = {
+    .classType = CLASS_FROZEN_MAP,
+    .delete    = &__CComp_Cls_FrozenMap_delete
+};
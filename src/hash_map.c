@@ -0,0 +1,432 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+#include "util/hash.h"
+
+#define this ((HashMap *) _this)
+
+#define MIN_CAPACITY 16
+
+/**
+ * Every slot has a control byte: EMPTY, DELETED or, for a used slot, the low
+ * 7 bits of its key's hash. Lookups compare a whole group of control bytes
+ * at once and only look at the slots whose byte matches.
+ */
+#define EMPTY ((signed char) -128)
+#define DELETED ((signed char) -2)
+
+#ifdef __SSE2__
+
+#include <emmintrin.h>
+
+#define GROUP_WIDTH 16
+
+/** One bit per control byte of the group, lowest bit first */
+typedef unsigned int Mask;
+
+static inline Mask matchByte(const signed char *group, signed char control) {
+    __m128i controls = _mm_loadu_si128((const __m128i *) group);
+    return (Mask) _mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(control)));
+}
+
+static inline Mask matchEmpty(const signed char *group) {
+    return matchByte(group, EMPTY);
+}
+
+/** EMPTY and DELETED are the only control bytes with the sign bit set */
+static inline Mask matchFree(const signed char *group) {
+    return (Mask) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) group));
+}
+
+static inline unsigned int nextMatch(Mask *mask) {
+    unsigned int index = (unsigned int) __builtin_ctz(*mask);
+    *mask &= *mask - 1;
+    return index;
+}
+
+#else
+
+#define GROUP_WIDTH 8
+
+/** The high bit of every byte of the word stands for the control byte at the same place */
+typedef uint64_t Mask;
+
+#define LSBS 0x0101010101010101ULL
+#define MSBS 0x8080808080808080ULL
+
+static inline uint64_t loadGroup(const signed char *group) {
+    uint64_t word;
+    memcpy(&word, group, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+/** May report a byte next to a real match too, candidates are verified by their hash anyway */
+static inline Mask matchByte(const signed char *group, signed char control) {
+    uint64_t word = loadGroup(group) ^ (LSBS * (unsigned char) control);
+    return (word - LSBS) & ~word & MSBS;
+}
+
+/** Bit 1 tells EMPTY (0x80) from DELETED (0xFE) */
+static inline Mask matchEmpty(const signed char *group) {
+    uint64_t word = loadGroup(group);
+    return word & ~(word << 6) & MSBS;
+}
+
+static inline Mask matchFree(const signed char *group) {
+    return loadGroup(group) & MSBS;
+}
+
+static inline unsigned int nextMatch(Mask *mask) {
+    unsigned int index = (unsigned int) __builtin_ctzll(*mask) >> 3;
+    *mask &= *mask - 1;
+    return index;
+}
+
+#endif
+
+/** Misses rarely get past the hash and the length to the key bytes */
+struct slot {
+    uint64_t hash;
+    unsigned long length;
+    char *key;
+    void *value;
+};
+
+typedef struct _hash_map_private {
+    /** capacity + GROUP_WIDTH bytes, the last group mirrors the first one so that groups never wrap */
+    signed char *controls;
+    struct slot *slots;
+    /** A power of two, 0 until the first set */
+    unsigned long capacity;
+    unsigned long mapSize;
+    /** Count of EMPTY slots that can still be taken before the table is rebuilt */
+    unsigned long growthLeft;
+} Private;
+
+static inline unsigned long maxLoad(unsigned long capacity) {
+
+    return capacity - capacity / 8;
+}
+
+static inline signed char controlOf(uint64_t hash) {
+
+    return (signed char) (hash & 0x7F);
+}
+
+static inline void setControl(Private *private, unsigned long index, signed char control) {
+
+    private->controls[index] = control;
+    if (index < GROUP_WIDTH)
+        private->controls[private->capacity + index] = control;
+
+}
+
+/** Probes group by group with growing steps, which visits every group of a power-of-two table */
+static struct slot *findSlot(Private *private, const char *key, unsigned long length, uint64_t hash) {
+
+    if (!private->capacity)
+        return NULL;
+
+    unsigned long mask = private->capacity - 1;
+    unsigned long position = (hash >> 7) & mask;
+    signed char control = controlOf(hash);
+
+    for (unsigned long stride = 0;;) {
+        const signed char *group = private->controls + position;
+
+        Mask matches = matchByte(group, control);
+        while (matches) {
+            struct slot *slot = &private->slots[(position + nextMatch(&matches)) & mask];
+            if (slot->hash == hash && slot->length == length && !memcmp(slot->key, key, length))
+                return slot;
+        }
+
+        if (matchEmpty(group))
+            return NULL;
+
+        stride += GROUP_WIDTH;
+        position = (position + stride) & mask;
+    }
+
+}
+
+/** Returns the first EMPTY or DELETED slot on the probe sequence of the hash */
+static unsigned long findFree(Private *private, uint64_t hash) {
+
+    unsigned long mask = private->capacity - 1;
+    unsigned long position = (hash >> 7) & mask;
+
+    for (unsigned long stride = 0;;) {
+        Mask free = matchFree(private->controls + position);
+        if (free)
+            return (position + nextMatch(&free)) & mask;
+
+        stride += GROUP_WIDTH;
+        position = (position + stride) & mask;
+    }
+
+}
+
+/** Moves all entries into a new table, which drops the DELETED markers as well */
+static void rehash(Private *private, unsigned long capacity) {
+
+    signed char *controls = private->controls;
+    struct slot *slots = private->slots;
+    unsigned long oldCapacity = private->capacity;
+
+    private->controls = malloc(capacity + GROUP_WIDTH);
+    private->slots = malloc(capacity * sizeof(struct slot));
+    private->capacity = capacity;
+    memset(private->controls, EMPTY, capacity + GROUP_WIDTH);
+
+    for (unsigned long index = 0; index < oldCapacity; index++) {
+        if (controls[index] < 0)
+            continue;
+
+        unsigned long newIndex = findFree(private, slots[index].hash);
+        setControl(private, newIndex, controls[index]);
+        private->slots[newIndex] = slots[index];
+    }
+
+    private->growthLeft = maxLoad(capacity) - private->mapSize;
+
+    free(controls);
+    free(slots);
+
+}
+
+extern void __CComp_HashMap_reserve(void *_this, unsigned long count) {
+
+    Private *private = (Private *) this->_private;
+
+    unsigned long capacity = MIN_CAPACITY;
+    while (maxLoad(capacity) < count)
+        capacity <<= 1;
+
+    if (capacity > private->capacity)
+        rehash(private, capacity);
+
+}
+
+extern void __CComp_HashMap_implMap_remove(void *_this, char *key) {
+
+    Private *private = (Private *) this->_private;
+
+    unsigned long length = strlen(key);
+    struct slot *slot = findSlot(private, key, length, _hash_bytes(key, length));
+    if (!slot)
+        return;
+
+    free(slot->key);
+    setControl(private, (unsigned long) (slot - private->slots), DELETED);
+    private->mapSize--;
+
+}
+
+extern void __CComp_HashMap_implMap_set(void *_this, char *key, void *value) {
+
+    Private *private = (Private *) this->_private;
+
+    unsigned long length = strlen(key);
+    uint64_t hash = _hash_bytes(key, length);
+
+    struct slot *slot = findSlot(private, key, length, hash);
+    if (slot) {
+        slot->value = value;
+        return;
+    }
+
+    if (!private->growthLeft) {
+        // When DELETED markers rather than entries used the room up, rebuild at the same size
+        if (!private->capacity)
+            rehash(private, MIN_CAPACITY);
+        else if (private->mapSize < maxLoad(private->capacity) / 2)
+            rehash(private, private->capacity);
+        else
+            rehash(private, private->capacity << 1);
+    }
+
+    unsigned long index = findFree(private, hash);
+    if (private->controls[index] == EMPTY)
+        private->growthLeft--;
+
+    setControl(private, index, controlOf(hash));
+
+    slot = &private->slots[index];
+    slot->hash = hash;
+    slot->length = length;
+    slot->key = malloc(length + 1);
+    memcpy(slot->key, key, length + 1);
+    slot->value = value;
+
+    private->mapSize++;
+
+}
+
+extern void *__CComp_HashMap_implMap_get(void *_this, char *key) {
+
+    unsigned long length = strlen(key);
+    struct slot *slot = findSlot((Private *) this->_private, key, length, _hash_bytes(key, length));
+
+    return slot ? slot->value : NULL;
+
+}
+
+extern unsigned long int __CComp_HashMap_implMap_length(void *_this) {
+
+    return ((Private *) this->_private)->mapSize;
+}
+
+/** Walks the slots in table order */
+extern void __CComp_HashMap_implMap_forEachEntry(void *_this, EntryCallback callback, void *context) {
+
+    Private *private = (Private *) this->_private;
+
+    for (unsigned long index = 0; index < private->capacity; index++)
+        if (private->controls[index] >= 0 &&
+            !callback(private->slots[index].key, private->slots[index].value, context))
+            return;
+
+}
+
+static bool iteratorNext(MapIterator *iterator) {
+
+    Private *private = (Private *) ((HashMap *) iterator->map)->_private;
+
+    while (iterator->index < private->capacity) {
+        unsigned long index = iterator->index++;
+        if (private->controls[index] < 0)
+            continue;
+
+        iterator->key = private->slots[index].key;
+        iterator->value = private->slots[index].value;
+        return true;
+    }
+
+    return false;
+
+}
+
+extern MapIterator __CComp_HashMap_implMap_iterator(void *_this) {
+
+    MapIterator iterator = { this, NULL, 0, &iteratorNext, NULL, NULL };
+    return iterator;
+
+}
+
+extern String *__CComp_HashMap_implObject_toString(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    String *result = CreateString("HashMap: [ ");
+    unsigned long printed = 0;
+    for (unsigned long index = 0; index < private->capacity; index++) {
+        if (private->controls[index] < 0)
+            continue;
+
+        result->class->add(result, private->slots[index].key);
+        result->class->add(result, ":");
+        result->class->addULong(result, (unsigned long) private->slots[index].value);
+        if (++printed != private->mapSize)
+            result->class->add(result, ", ");
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, private->mapSize);
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+/** Copies the table as it is, only the keys are duplicated */
+extern void *__CComp_HashMap_implObject_copy(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    HashMap *newHashMap = createHashMap();
+    if (!private->capacity)
+        return newHashMap;
+
+    Private *newPrivate = (Private *) newHashMap->_private;
+    newPrivate->controls = malloc(private->capacity + GROUP_WIDTH);
+    newPrivate->slots = malloc(private->capacity * sizeof(struct slot));
+    newPrivate->capacity = private->capacity;
+    newPrivate->mapSize = private->mapSize;
+    newPrivate->growthLeft = private->growthLeft;
+
+    memcpy(newPrivate->controls, private->controls, private->capacity + GROUP_WIDTH);
+    for (unsigned long index = 0; index < private->capacity; index++) {
+        if (private->controls[index] < 0)
+            continue;
+
+        struct slot *slot = &newPrivate->slots[index];
+        *slot = private->slots[index];
+        slot->key = malloc(slot->length + 1);
+        memcpy(slot->key, private->slots[index].key, slot->length + 1);
+    }
+
+    return newHashMap;
+
+}
+
+extern HashMap *createHashMap() {
+
+    HashMap *newHashMap = (HashMap *) malloc(sizeof(HashMap));
+
+    Private *private = (Private *) malloc(sizeof(Private));
+    private->controls = NULL;
+    private->slots = NULL;
+    private->capacity = 0;
+    private->mapSize = 0;
+    private->growthLeft = 0;
+
+    newHashMap->_private = private;
+    newHashMap->class = &ClassHashMap;
+    newHashMap->_class = &classHashMap;
+
+    return newHashMap;
+
+}
+
+extern void __CComp_Cls_HashMap_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    for (unsigned long index = 0; index < private->capacity; index++)
+        if (private->controls[index] >= 0)
+            free(private->slots[index].key);
+
+    free(private->controls);
+    free(private->slots);
+    free(private);
+    free(this);
+
+}
+
+ClassHashMapType ClassHashMap = {
+    &__CComp_HashMap_reserve,
+    {
+        INTERFACE_MAP,
+        &__CComp_HashMap_implMap_remove,
+        &__CComp_HashMap_implMap_set,
+        &__CComp_HashMap_implMap_get,
+        &__CComp_HashMap_implMap_length,
+        &__CComp_HashMap_implMap_forEachEntry,
+        &__CComp_HashMap_implMap_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_HashMap_implObject_toString,
+            &__CComp_HashMap_implObject_copy
+        }
+    }
+};
+
+Class classHashMap = {
+    .classType = CLASS_HASH_MAP,
+    .delete    = &__CComp_Cls_HashMap_delete
+};
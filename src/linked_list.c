@@ -1,3 +1,4 @@
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <stdbool.h>
 
@@ -5,15 +6,118 @@
 
 #define this ((LinkedList *) _this)
 
+#define MIN_SLAB_ENTRIES 16
+#define MAX_SLAB_ENTRIES 4096
+
+struct entry {
+    void *value;
+    struct entry *previous;
+    /** Links the free entries too */
+    struct entry *next;
+    struct slab *slab;
+};
+
+/**
+ * A block of entries. Entries move between lists through splice, splitAt and
+ * moveRange, so a slab can be referenced by several lists. live counts the
+ * entries not released yet, starting with all of them: the ones a list has
+ * not carved yet are released together with the rest of that list's entries
+ * when it is deleted. Whoever releases the last entry frees the slab.
+ */
+struct slab {
+    atomic_ulong live;
+    struct entry entries[];
+};
+
 typedef struct _list_private {
-    struct entry {
-        void *value;
-        struct entry *previous;
-        struct entry *next;
-    } *firstEntry, *lastEntry;
+    struct entry *firstEntry, *lastEntry;
     unsigned long int listSize;
+    /** The slab entries are carved from, NULL until the first entry is allocated */
+    struct slab *slab;
+    /**
+     * Count of entries already handed out from the slab and its capacity. Once
+     * it is carved out, other lists may free the slab, so it is not read anymore.
+     */
+    unsigned long slabUsed, slabCapacity;
+    /** Entries removed from this list, whichever slab they come from */
+    struct entry *freeEntries;
+    /** The entry accessed last by index, NULL once a structural change makes fingerIndex stale */
+    struct entry *fingerEntry;
+    unsigned long fingerIndex;
 } Private;
 
+static void releaseSlab(struct slab *slab, unsigned long count) {
+
+    if (slab && count && atomic_fetch_sub(&slab->live, count) == count)
+        free(slab);
+
+}
+
+/** Releases a chain linked through next, one atomic update per run of entries from the same slab */
+static void releaseEntries(struct entry *entry) {
+
+    struct slab *slab = NULL;
+    unsigned long count = 0;
+
+    for (; entry; entry = entry->next) {
+        if (entry->slab != slab) {
+            releaseSlab(slab, count);
+            slab = entry->slab;
+            count = 0;
+        }
+        count++;
+    }
+
+    releaseSlab(slab, count);
+
+}
+
+/** Makes a new slab the one being carved, leaving the previous one to its entries */
+static struct slab *addSlab(Private *private, unsigned long capacity) {
+
+    struct slab *slab = malloc(sizeof(struct slab) + capacity * sizeof(struct entry));
+    atomic_init(&slab->live, capacity);
+
+    private->slab = slab;
+    private->slabUsed = 0;
+    private->slabCapacity = capacity;
+
+    return slab;
+
+}
+
+/** Takes a recycled entry, carves a new one from the current slab or starts a bigger slab */
+static struct entry *allocateEntry(Private *private) {
+
+    struct entry *entry = private->freeEntries;
+    if (entry) {
+        private->freeEntries = entry->next;
+        return entry;
+    }
+
+    if (!private->slab || private->slabUsed == private->slabCapacity) {
+        unsigned long capacity = private->slab ? private->slabCapacity << 1 : MIN_SLAB_ENTRIES;
+        if (capacity > MAX_SLAB_ENTRIES)
+            capacity = MAX_SLAB_ENTRIES;
+
+        addSlab(private, capacity);
+    }
+
+    entry = &private->slab->entries[private->slabUsed++];
+    entry->slab = private->slab;
+
+    return entry;
+
+}
+
+/** The entry stays counted in its slab until the list is deleted */
+static inline void freeEntry(Private *private, struct entry *entry) {
+
+    entry->next = private->freeEntries;
+    private->freeEntries = entry;
+
+}
+
 static inline struct entry *getEntryForwards
         (struct entry *first, unsigned long count) {
 
@@ -52,27 +156,47 @@ static void removeEntry(Private *private, struct entry *entry) {
     } else
         entry->next->previous = entry->previous;
 
-    free(entry);
+    freeEntry(private, entry);
+    private->fingerEntry = NULL;
     private->listSize--;
 
 }
 
-/** May return NULL */
+/** Walks from whichever of the first entry, the last entry and the finger is nearest */
 static struct entry *getEntry(Private *private, unsigned long index) {
 
     unsigned long maxIndex = private->listSize - 1;
     bool forwards = maxIndex - index > maxIndex >> 1;
 
-    return forwards ?
-        getEntryForwards(private->firstEntry, index) :
-        getEntryBackwards(private->lastEntry, maxIndex - index);
+    unsigned long distance = forwards ? index : maxIndex - index;
+    struct entry *result = NULL;
+
+    if (private->fingerEntry) {
+        unsigned long finger = private->fingerIndex;
+        unsigned long fingerDistance = index > finger ? index - finger : finger - index;
+
+        if (fingerDistance < distance)
+            result = index > finger ?
+                getEntryForwards(private->fingerEntry, fingerDistance) :
+                getEntryBackwards(private->fingerEntry, fingerDistance);
+    }
+
+    if (!result)
+        result = forwards ?
+            getEntryForwards(private->firstEntry, index) :
+            getEntryBackwards(private->lastEntry, maxIndex - index);
+
+    private->fingerEntry = result;
+    private->fingerIndex = index;
+
+    return result;
 
 }
 
 extern void __CComp_LinkedList_implList_add(void *_this, void *value) {
 
     Private *private = (Private *) this->_private;
-    struct entry *newLastEntry = malloc(sizeof(struct entry));
+    struct entry *newLastEntry = allocateEntry(private);
 
     if (!private->listSize) {
         private->firstEntry = private->lastEntry = newLastEntry;
@@ -93,9 +217,14 @@ extern void __CComp_LinkedList_implList_remove
 
     Private *private = (Private *) this->_private;
     struct entry *entry = getEntry(private, index);
+    struct entry *next = entry->next;
 
     removeEntry(private, entry);
 
+    // The next entry takes over the removed one's index
+    private->fingerEntry = next;
+    private->fingerIndex = index;
+
 }
 
 extern void __CComp_LinkedList_implList_set
@@ -115,6 +244,42 @@ extern unsigned long __CComp_LinkedList_implList_length(void *_this) {
     return ((Private *) this->_private)->listSize;
 }
 
+/** The cursor is the entry the next call of next returns */
+static bool iteratorHasNext(ListIterator *iterator) {
+
+    return iterator->cursor;
+}
+
+static void *iteratorNext(ListIterator *iterator) {
+
+    struct entry *entry = (struct entry *) iterator->cursor;
+    iterator->cursor = entry->next;
+    iterator->index++;
+
+    return entry->value;
+
+}
+
+static void iteratorRemove(ListIterator *iterator) {
+
+    Private *private = (Private *) ((LinkedList *) iterator->list)->_private;
+    struct entry *cursor = (struct entry *) iterator->cursor;
+
+    removeEntry(private, cursor ? cursor->previous : private->lastEntry);
+    iterator->index--;
+
+}
+
+extern ListIterator __CComp_LinkedList_implList_iterator(void *_this) {
+
+    ListIterator iterator = {
+        this, ((Private *) this->_private)->firstEntry, 0,
+        &iteratorHasNext, &iteratorNext, &iteratorRemove
+    };
+    return iterator;
+
+}
+
 String * __CComp_LinkedList_implObject_toString(void *_this) {
 
     Private *private = (Private *) this->_private;
@@ -139,6 +304,7 @@ String * __CComp_LinkedList_implObject_toString(void *_this) {
 
 }
 
+/** Clones the chain in one pass into a single slab sized to the list */
 extern void *__CComp_LinkedList_implObject_copy(void *_this) {
 
     LinkedList *result = createLinkedList();
@@ -146,14 +312,26 @@ extern void *__CComp_LinkedList_implObject_copy(void *_this) {
     Private *privateSrc = (Private *) this->_private;
     Private *privateDst = (Private *) result->_private;
 
-    *privateDst = *privateSrc;
-    struct entry *entry = malloc(sizeof(struct entry));
-    *entry = *privateSrc->firstEntry;
+    unsigned long count = privateSrc->listSize;
+    if (!count)
+        return result;
 
-    for (; entry->next; entry = entry->next) {
-        entry->next->previous = entry;
+    struct slab *slab = addSlab(privateDst, count);
+    struct entry *entries = slab->entries;
+    privateDst->slabUsed = count;
+
+    struct entry *cursor = privateSrc->firstEntry;
+    for (unsigned long index = 0; index < count; index++, cursor = cursor->next) {
+        entries[index].value = cursor->value;
+        entries[index].slab = slab;
+        entries[index].previous = index ? &entries[index - 1] : NULL;
+        entries[index].next = index + 1 < count ? &entries[index + 1] : NULL;
     }
 
+    privateDst->firstEntry = entries;
+    privateDst->lastEntry = &entries[count - 1];
+    privateDst->listSize = count;
+
     return result;
 
 }
@@ -162,15 +340,18 @@ extern void __CComp_LinkedList_addFirst(void *_this, void *value) {
 
     Private *private = (Private *) this->_private;
 
-    struct entry *entry = malloc(sizeof(struct entry));
+    struct entry *entry = allocateEntry(private);
     entry->previous = NULL;
     entry->next = private->firstEntry;
     entry->value = value;
 
     if (private->firstEntry)
         private->firstEntry->previous = entry;
-    
+    else
+        private->lastEntry = entry;
+
     private->firstEntry = entry;
+    private->fingerIndex++;
     private->listSize++;
 
 }
@@ -201,12 +382,171 @@ extern void __CComp_LinkedList_removeLast(void *_this) {
         removeEntry((Private *) this->_private, entry);
 }
 
+/** Appends the entries of the other list in O(1), leaving it empty */
+extern void __CComp_LinkedList_splice(void *_this, LinkedList *other) {
+
+    Private *private = (Private *) this->_private;
+    Private *otherPrivate = (Private *) other->_private;
+    if (private == otherPrivate || !otherPrivate->listSize)
+        return;
+
+    if (private->listSize) {
+        private->lastEntry->next = otherPrivate->firstEntry;
+        otherPrivate->firstEntry->previous = private->lastEntry;
+    } else
+        private->firstEntry = otherPrivate->firstEntry;
+
+    private->lastEntry = otherPrivate->lastEntry;
+    private->listSize += otherPrivate->listSize;
+
+    otherPrivate->firstEntry = otherPrivate->lastEntry = NULL;
+    otherPrivate->fingerEntry = NULL;
+    otherPrivate->listSize = 0;
+
+}
+
+/** Moves the entries from the index to the end into a new list */
+extern LinkedList *__CComp_LinkedList_splitAt(void *_this, unsigned long index) {
+
+    Private *private = (Private *) this->_private;
+    LinkedList *result = createLinkedList();
+    if (index >= private->listSize)
+        return result;
+
+    Private *resultPrivate = (Private *) result->_private;
+    struct entry *entry = getEntry(private, index);
+    resultPrivate->firstEntry = entry;
+    resultPrivate->lastEntry = private->lastEntry;
+    resultPrivate->listSize = private->listSize - index;
+
+    private->lastEntry = entry->previous;
+    if (private->lastEntry)
+        private->lastEntry->next = NULL;
+    else
+        private->firstEntry = NULL;
+
+    entry->previous = NULL;
+    private->fingerEntry = NULL;
+    private->listSize = index;
+
+    return result;
+
+}
+
+/** Moves the entries from the first index (inclusive) to the second one (exclusive) to the end of the target */
+extern void __CComp_LinkedList_moveRange
+            (void *_this, unsigned long from, unsigned long to, LinkedList *target) {
+
+    Private *private = (Private *) this->_private;
+    Private *targetPrivate = (Private *) target->_private;
+    if (from >= to)
+        return;
+
+    struct entry *first = getEntry(private, from);
+    struct entry *last = getEntry(private, to - 1);
+
+    if (first->previous)
+        first->previous->next = last->next;
+    else
+        private->firstEntry = last->next;
+
+    if (last->next)
+        last->next->previous = first->previous;
+    else
+        private->lastEntry = first->previous;
+
+    private->fingerEntry = NULL;
+    private->listSize -= to - from;
+
+    first->previous = targetPrivate->lastEntry;
+    last->next = NULL;
+
+    if (targetPrivate->lastEntry)
+        targetPrivate->lastEntry->next = first;
+    else
+        targetPrivate->firstEntry = first;
+
+    targetPrivate->lastEntry = last;
+    targetPrivate->listSize += to - from;
+
+}
+
+/** Merges two NULL-terminated chains linked through next only, taking from the left one on ties */
+static struct entry *mergeRuns(struct entry *left, struct entry *right, Comparator comparator) {
+
+    struct entry head, *tail = &head;
+    while (left && right) {
+        if (comparator(right->value, left->value) < 0) {
+            tail->next = right;
+            right = right->next;
+        } else {
+            tail->next = left;
+            left = left->next;
+        }
+        tail = tail->next;
+    }
+
+    tail->next = left ? left : right;
+    return head.next;
+
+}
+
+/** Stable bottom-up merge sort that relinks the entries instead of moving values */
+extern void __CComp_LinkedList_sort(void *_this, Comparator comparator) {
+
+    Private *private = (Private *) this->_private;
+    if (private->listSize < 2)
+        return;
+
+    // runs[level] is either empty or a sorted chain of 2^level entries
+    struct entry *runs[sizeof(unsigned long) * 8] = { NULL };
+    unsigned int levels = 0;
+
+    struct entry *entry = private->firstEntry;
+    while (entry) {
+        struct entry *run = entry;
+        entry = entry->next;
+        run->next = NULL;
+
+        unsigned int level = 0;
+        for (; level < levels && runs[level]; level++) {
+            run = mergeRuns(runs[level], run, comparator);
+            runs[level] = NULL;
+        }
+
+        runs[level] = run;
+        if (level == levels)
+            levels++;
+    }
+
+    // Higher levels hold earlier entries, so they go on the left
+    struct entry *sorted = NULL;
+    for (unsigned int level = 0; level < levels; level++)
+        if (runs[level])
+            sorted = sorted ? mergeRuns(runs[level], sorted, comparator) : runs[level];
+
+    struct entry *previous = NULL;
+    for (entry = sorted; entry; entry = entry->next) {
+        entry->previous = previous;
+        previous = entry;
+    }
+
+    private->firstEntry = sorted;
+    private->lastEntry = previous;
+    private->fingerEntry = NULL;
+
+}
+
 extern LinkedList *createLinkedList() {
 
     LinkedList *newLinkedList = (LinkedList *) malloc(sizeof(LinkedList));
     Private *private = (Private *) malloc(sizeof(Private));
     private->listSize = 0;
     private->firstEntry = private->lastEntry = NULL;
+    private->slab = NULL;
+    private->slabUsed = private->slabCapacity = 0;
+    private->freeEntries = NULL;
+    private->fingerEntry = NULL;
     newLinkedList->_private = private;
     newLinkedList->class = &ClassLinkedList;
     newLinkedList->_class = &classLinkedList;
@@ -219,12 +559,9 @@ extern void __CComp_Cls_LinkedList_delete(void *_this) {
 
     Private *private = (Private *) this->_private;
 
-    struct entry *cursor = private->firstEntry;
-    while (cursor) {
-        struct entry *next = cursor->next;
-        free(cursor);
-        cursor = next;
-    }
+    releaseEntries(private->firstEntry);
+    releaseEntries(private->freeEntries);
+    releaseSlab(private->slab, private->slabCapacity - private->slabUsed);
 
     free(private);
     free(this);
@@ -237,6 +574,10 @@ ClassLinkedListType ClassLinkedList = {
     &__CComp_LinkedList_getLast,
     &__CComp_LinkedList_removeFirst,
     &__CComp_LinkedList_removeLast,
+    &__CComp_LinkedList_splice,
+    &__CComp_LinkedList_splitAt,
+    &__CComp_LinkedList_moveRange,
+    &__CComp_LinkedList_sort,
     {
         INTERFACE_LIST,
         &__CComp_LinkedList_implList_add,
@@ -244,6 +585,7 @@ ClassLinkedListType ClassLinkedList = {
         &__CComp_LinkedList_implList_set,
         &__CComp_LinkedList_implList_get,
         &__CComp_LinkedList_implList_length,
+        &__CComp_LinkedList_implList_iterator,
         {
             INTERFACE_CCOBJECT,
             &__CComp_LinkedList_implObject_toString,
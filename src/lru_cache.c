@@ -0,0 +1,267 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+
+#define this ((LRUCache *) _this)
+
+/** An entry of the recency list, the index maps keys to these */
+struct entry {
+    struct entry *newer;
+    struct entry *older;
+    void *value;
+    char key[];
+};
+
+typedef struct _lru_cache_private {
+    HashMap *index;
+    struct entry *newest;
+    struct entry *oldest;
+    unsigned long int capacity;
+    unsigned long int hits;
+    unsigned long int misses;
+    EvictionCallback onEvict;
+    void *context;
+} Private;
+
+static void unlinkEntry(Private *private, struct entry *entry) {
+    if (entry->newer)
+        entry->newer->older = entry->older;
+    else
+        private->newest = entry->older;
+
+    if (entry->older)
+        entry->older->newer = entry->newer;
+    else
+        private->oldest = entry->newer;
+}
+
+static void linkNewest(Private *private, struct entry *entry) {
+    entry->newer = NULL;
+    entry->older = private->newest;
+
+    if (private->newest)
+        private->newest->newer = entry;
+    else
+        private->oldest = entry;
+
+    private->newest = entry;
+}
+
+static void promote(Private *private, struct entry *entry) {
+    if (entry == private->newest)
+        return;
+
+    unlinkEntry(private, entry);
+    linkNewest(private, entry);
+}
+
+/** Drops the least recently used entry before telling the callback, so that the callback finds the cache consistent */
+static void evictOldest(Private *private) {
+    struct entry *entry = private->oldest;
+
+    unlinkEntry(private, entry);
+    ClassHashMap._impl_Map.remove(private->index, entry->key);
+
+    if (private->onEvict)
+        private->onEvict(entry->key, entry->value, private->context);
+    free(entry);
+}
+
+extern void *__CComp_LRUCache_peek(void *_this, char *key) {
+    Private *private = (Private *) this->_private;
+    struct entry *entry = (struct entry *) ClassHashMap._impl_Map.get(private->index, key);
+
+    return entry ? entry->value : NULL;
+}
+
+extern unsigned long int __CComp_LRUCache_capacity(void *_this) {
+    return ((Private *) this->_private)->capacity;
+}
+
+extern unsigned long int __CComp_LRUCache_hits(void *_this) {
+    return ((Private *) this->_private)->hits;
+}
+
+extern unsigned long int __CComp_LRUCache_misses(void *_this) {
+    return ((Private *) this->_private)->misses;
+}
+
+extern void __CComp_LRUCache_implMap_remove(void *_this, char *key) {
+    Private *private = (Private *) this->_private;
+    struct entry *entry = (struct entry *) ClassHashMap._impl_Map.get(private->index, key);
+    if (!entry)
+        return;
+
+    unlinkEntry(private, entry);
+    ClassHashMap._impl_Map.remove(private->index, key);
+    free(entry);
+}
+
+/**
+ * Puts the entry at the front, then evicts least recently used entries until
+ * the cache is within capacity again. The length is checked anew after every
+ * eviction, as the callback may have added entries itself.
+ */
+extern void __CComp_LRUCache_implMap_set(void *_this, char *key, void *value) {
+    Private *private = (Private *) this->_private;
+    struct entry *entry = (struct entry *) ClassHashMap._impl_Map.get(private->index, key);
+
+    if (entry) {
+        entry->value = value;
+        promote(private, entry);
+        return;
+    }
+
+    size_t size = strlen(key) + 1;
+    entry = (struct entry *) malloc(sizeof(struct entry) + size);
+    entry->value = value;
+    memcpy(entry->key, key, size);
+
+    ClassHashMap._impl_Map.set(private->index, key, entry);
+    linkNewest(private, entry);
+
+    // A cache without capacity evicts the new entry right away
+    while (ClassHashMap._impl_Map.length(private->index) > private->capacity)
+        evictOldest(private);
+}
+
+extern void *__CComp_LRUCache_implMap_get(void *_this, char *key) {
+    Private *private = (Private *) this->_private;
+    struct entry *entry = (struct entry *) ClassHashMap._impl_Map.get(private->index, key);
+
+    if (!entry) {
+        private->misses++;
+        return NULL;
+    }
+
+    private->hits++;
+    promote(private, entry);
+
+    return entry->value;
+}
+
+extern unsigned long int __CComp_LRUCache_implMap_length(void *_this) {
+    return ClassHashMap._impl_Map.length(((Private *) this->_private)->index);
+}
+
+/** Walks from the most to the least recently used entry without promoting any */
+extern void __CComp_LRUCache_implMap_forEachEntry(void *_this, EntryCallback callback, void *context) {
+    for (struct entry *entry = ((Private *) this->_private)->newest; entry; entry = entry->older)
+        if (!callback(entry->key, entry->value, context))
+            return;
+}
+
+/** cursor is the entry to return next */
+static bool iteratorNext(MapIterator *iterator) {
+    struct entry *entry = (struct entry *) iterator->cursor;
+    if (!entry)
+        return false;
+
+    iterator->key = entry->key;
+    iterator->value = entry->value;
+    iterator->cursor = entry->older;
+    iterator->index++;
+    return true;
+}
+
+extern MapIterator __CComp_LRUCache_implMap_iterator(void *_this) {
+    MapIterator iterator = { this, ((Private *) this->_private)->newest, 0, &iteratorNext, NULL, NULL };
+    return iterator;
+}
+
+extern String *__CComp_LRUCache_implObject_toString(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    String *result = CreateString("LRUCache: [ ");
+    for (struct entry *entry = private->newest; entry; entry = entry->older) {
+        result->class->add(result, entry->key);
+        result->class->add(result, ":");
+        result->class->addULong(result, (unsigned long int) (uintptr_t) entry->value);
+        if (entry->older)
+            result->class->add(result, ", ");
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, __CComp_LRUCache_implMap_length(this));
+    result->class->add(result, ");");
+
+    return result;
+}
+
+/** Keeps the recency order, the counters and the eviction callback */
+extern void *__CComp_LRUCache_implObject_copy(void *_this) {
+    Private *private = (Private *) this->_private;
+    LRUCache *newCache = createLRUCache(private->capacity, private->onEvict, private->context);
+    Private *newPrivate = (Private *) newCache->_private;
+
+    ClassHashMap.reserve(newPrivate->index, __CComp_LRUCache_implMap_length(this));
+    for (struct entry *entry = private->oldest; entry; entry = entry->newer)
+        __CComp_LRUCache_implMap_set(newCache, entry->key, entry->value);
+
+    newPrivate->hits = private->hits;
+    newPrivate->misses = private->misses;
+
+    return newCache;
+}
+
+extern LRUCache *createLRUCache(unsigned long int capacity, EvictionCallback onEvict, void *context) {
+    LRUCache *newCache = (LRUCache *) malloc(sizeof(LRUCache));
+
+    Private *private  = (Private *) malloc(sizeof(Private));
+    private->index    = CreateHashMap();
+    private->newest   = NULL;
+    private->oldest   = NULL;
+    private->capacity = capacity;
+    private->hits     = 0;
+    private->misses   = 0;
+    private->onEvict  = onEvict;
+    private->context  = context;
+
+    newCache->_private = private;
+    newCache->class    = &ClassLRUCache;
+    newCache->_class   = &classLRUCache;
+
+    return newCache;
+}
+
+/** Releases the entries without calling the eviction callback */
+extern void __CComp_Cls_LRUCache_delete(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    for (struct entry *entry = private->newest, *older; entry; entry = older) {
+        older = entry->older;
+        free(entry);
+    }
+
+    delete(private->index);
+    free(private);
+    free(this);
+}
+
+ClassLRUCacheType ClassLRUCache = {
+    &__CComp_LRUCache_peek,
+    &__CComp_LRUCache_capacity,
+    &__CComp_LRUCache_hits,
+    &__CComp_LRUCache_misses,
+    {
+        INTERFACE_MAP,
+        &__CComp_LRUCache_implMap_remove,
+        &__CComp_LRUCache_implMap_set,
+        &__CComp_LRUCache_implMap_get,
+        &__CComp_LRUCache_implMap_length,
+        &__CComp_LRUCache_implMap_forEachEntry,
+        &__CComp_LRUCache_implMap_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_LRUCache_implObject_toString,
+            &__CComp_LRUCache_implObject_copy
+        }
+    }
+};
+
+Class classLRUCache = {
+    .classType = CLASS_LRU_CACHE,
+    .delete    = &__CComp_Cls_LRUCache_delete
+};
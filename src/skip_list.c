@@ -0,0 +1,352 @@
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "ccomponents.h"
+
+#define this ((SkipList *) _this)
+
+/** With a quarter of the nodes promoted per level, 32 levels cover any list size */
+#define MAX_LEVEL 32
+
+struct node;
+
+struct link {
+    struct node *next;
+    /** Count of positions the link skips, next being past the end counts as position listSize + 1 */
+    unsigned long span;
+};
+
+struct node {
+    void *value;
+    unsigned int height;
+    struct link links[];
+};
+
+typedef struct _skip_list_private {
+    /** Sentinel at position 0, the element at index i is at position i + 1 */
+    struct node *head;
+    /** Count of levels in use, head spans above it are stale */
+    unsigned int level;
+    unsigned long int listSize;
+    unsigned long random;
+} Private;
+
+/** Finds, per level, the last node before the position and the position of that node */
+struct path {
+    struct node *nodes[MAX_LEVEL];
+    unsigned long positions[MAX_LEVEL];
+};
+
+static unsigned int randomHeight(Private *private) {
+
+    // xorshift64
+    unsigned long random = private->random;
+    random ^= random << 13;
+    random ^= random >> 7;
+    random ^= random << 17;
+    private->random = random;
+
+    unsigned int height = 1;
+    while (height < MAX_LEVEL && !(random & 3)) {
+        height++;
+        random >>= 2;
+    }
+
+    return height;
+
+}
+
+/** Fills the path to the node that comes right before the given position and returns that node */
+static struct node *findPosition(Private *private, unsigned long position, struct path *path) {
+
+    struct node *node = private->head;
+    unsigned long traversed = 0;
+
+    for (unsigned int level = private->level; level--;) {
+        while (node->links[level].next && traversed + node->links[level].span < position) {
+            traversed += node->links[level].span;
+            node = node->links[level].next;
+        }
+
+        path->nodes[level] = node;
+        path->positions[level] = traversed;
+    }
+
+    return node;
+
+}
+
+/** Fills the path to the last node whose value is less (or not greater) than the given one */
+static unsigned long findValue
+        (Private *private, void *value, Comparator comparator, bool upper, struct path *path) {
+
+    struct node *node = private->head;
+    unsigned long traversed = 0;
+
+    for (unsigned int level = private->level; level--;) {
+        while (node->links[level].next) {
+            int comparison = comparator(node->links[level].next->value, value);
+            if (comparison > 0 || (!upper && !comparison))
+                break;
+
+            traversed += node->links[level].span;
+            node = node->links[level].next;
+        }
+
+        path->nodes[level] = node;
+        path->positions[level] = traversed;
+    }
+
+    return traversed;
+
+}
+
+/** Links a new node in at the index the path leads to */
+static void insertNode(Private *private, struct path *path, unsigned long index, void *value) {
+
+    unsigned int height = randomHeight(private);
+    for (; private->level < height; private->level++) {
+        private->head->links[private->level].next = NULL;
+        private->head->links[private->level].span = private->listSize + 1;
+
+        path->nodes[private->level] = private->head;
+        path->positions[private->level] = 0;
+    }
+
+    struct node *node = malloc(sizeof(struct node) + height * sizeof(struct link));
+    node->value = value;
+    node->height = height;
+
+    for (unsigned int level = 0; level < height; level++) {
+        struct link *link = &path->nodes[level]->links[level];
+        unsigned long skipped = index - path->positions[level];
+
+        node->links[level].next = link->next;
+        node->links[level].span = link->span - skipped;
+
+        link->next = node;
+        link->span = skipped + 1;
+    }
+
+    for (unsigned int level = height; level < private->level; level++)
+        path->nodes[level]->links[level].span++;
+
+    private->listSize++;
+
+}
+
+static struct node *getNode(Private *private, unsigned long index) {
+
+    struct path path;
+    return findPosition(private, index + 1, &path)->links[0].next;
+
+}
+
+extern void __CComp_SkipList_insertAt(void *_this, unsigned long index, void *value) {
+
+    Private *private = (Private *) this->_private;
+
+    struct path path;
+    findPosition(private, index + 1, &path);
+    insertNode(private, &path, index, value);
+
+}
+
+/** Inserts the value after all elements that are not greater than it, returns its index */
+extern unsigned long __CComp_SkipList_insertSorted
+            (void *_this, void *value, Comparator comparator) {
+
+    Private *private = (Private *) this->_private;
+
+    struct path path;
+    unsigned long index = findValue(private, value, comparator, true, &path);
+    insertNode(private, &path, index, value);
+
+    return index;
+
+}
+
+/** Returns the index of the first element that is not less than the value, or the length */
+extern unsigned long __CComp_SkipList_lowerBound
+            (void *_this, void *value, Comparator comparator) {
+
+    struct path path;
+    return findValue((Private *) this->_private, value, comparator, false, &path);
+}
+
+extern void __CComp_SkipList_implList_add(void *_this, void *value) {
+
+    __CComp_SkipList_insertAt(this, ((Private *) this->_private)->listSize, value);
+}
+
+extern void __CComp_SkipList_implList_remove
+            (void *_this, unsigned long index) {
+
+    Private *private = (Private *) this->_private;
+
+    struct path path;
+    struct node *node = findPosition(private, index + 1, &path)->links[0].next;
+    for (unsigned int level = 0; level < private->level; level++) {
+        struct link *link = &path.nodes[level]->links[level];
+
+        if (link->next == node) {
+            link->span += node->links[level].span - 1;
+            link->next = node->links[level].next;
+        } else
+            link->span--;
+    }
+
+    while (private->level > 1 && !private->head->links[private->level - 1].next)
+        private->level--;
+
+    free(node);
+    private->listSize--;
+
+}
+
+extern void __CComp_SkipList_implList_set
+            (void *_this, unsigned long index, void *value) {
+
+    getNode((Private *) this->_private, index)->value = value;
+}
+
+extern void *__CComp_SkipList_implList_get
+            (void *_this, unsigned long index) {
+
+    return getNode((Private *) this->_private, index)->value;
+}
+
+extern unsigned long __CComp_SkipList_implList_length(void *_this) {
+
+    return ((Private *) this->_private)->listSize;
+}
+
+/** The cursor is the node the next call of next returns */
+static bool iteratorHasNext(ListIterator *iterator) {
+
+    return iterator->cursor;
+}
+
+static void *iteratorNext(ListIterator *iterator) {
+
+    struct node *node = (struct node *) iterator->cursor;
+    iterator->cursor = node->links[0].next;
+    iterator->index++;
+
+    return node->value;
+
+}
+
+static void iteratorRemove(ListIterator *iterator) {
+
+    __CComp_SkipList_implList_remove(iterator->list, --iterator->index);
+}
+
+extern ListIterator __CComp_SkipList_implList_iterator(void *_this) {
+
+    ListIterator iterator = {
+        this, ((Private *) this->_private)->head->links[0].next, 0,
+        &iteratorHasNext, &iteratorNext, &iteratorRemove
+    };
+    return iterator;
+
+}
+
+String *__CComp_SkipList_implObject_toString(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    String *result = CreateString("SkipList: [ ");
+    struct node *cursor = private->head->links[0].next;
+    while (cursor) {
+
+        result->class->addULong(result, (unsigned long) cursor->value);
+        cursor = cursor->links[0].next;
+        if (cursor)
+            result->class->add(result, ", ");
+
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, private->listSize);
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+extern void *__CComp_SkipList_implObject_copy(void *_this) {
+
+    SkipList *result = createSkipList();
+
+    struct node *cursor = ((Private *) this->_private)->head->links[0].next;
+    for (; cursor; cursor = cursor->links[0].next)
+        __CComp_SkipList_implList_add(result, cursor->value);
+
+    return result;
+
+}
+
+extern SkipList *createSkipList() {
+
+    SkipList *newSkipList = (SkipList *) malloc(sizeof(SkipList));
+    Private *private = (Private *) malloc(sizeof(Private));
+
+    private->head = malloc(sizeof(struct node) + MAX_LEVEL * sizeof(struct link));
+    private->head->value = NULL;
+    private->head->height = MAX_LEVEL;
+    private->head->links[0].next = NULL;
+    private->head->links[0].span = 1;
+
+    private->level = 1;
+    private->listSize = 0;
+    private->random = (unsigned long) private | 1;
+
+    newSkipList->_private = private;
+    newSkipList->class = &ClassSkipList;
+    newSkipList->_class = &classSkipList;
+
+    return newSkipList;
+
+}
+
+extern void __CComp_Cls_SkipList_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    struct node *node = private->head;
+    while (node) {
+        struct node *next = node->links[0].next;
+        free(node);
+        node = next;
+    }
+
+    free(private);
+    free(this);
+
+}
+
+ClassSkipListType ClassSkipList = {
+    &__CComp_SkipList_insertAt,
+    &__CComp_SkipList_insertSorted,
+    &__CComp_SkipList_lowerBound,
+    {
+        INTERFACE_LIST,
+        &__CComp_SkipList_implList_add,
+        &__CComp_SkipList_implList_remove,
+        &__CComp_SkipList_implList_set,
+        &__CComp_SkipList_implList_get,
+        &__CComp_SkipList_implList_length,
+        &__CComp_SkipList_implList_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_SkipList_implObject_toString,
+            &__CComp_SkipList_implObject_copy
+        }
+    }
+};
+
+Class classSkipList = {
+    .classType = CLASS_SKIP_LIST,
+    .delete    = &__CComp_Cls_SkipList_delete
+};
@@ -0,0 +1,348 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+
+#define this ((SortedArrayMap *) _this)
+
+#define MIN_CAPACITY 8
+
+struct entry {
+    char *key;
+    void *value;
+};
+
+/**
+ * Entries are sorted by key. The first 8 bytes of every key are also kept
+ * in a separate array as a big-endian integer, so that the binary search
+ * compares integers in a dense array and only looks at key bytes among
+ * keys with the same prefix.
+ */
+typedef struct _sorted_map_private {
+    uint64_t *prefixes;
+    struct entry *entries;
+    unsigned long int mapSize;
+    unsigned long int capacity;
+} Private;
+
+/** Orders like strcmp does on the first 8 bytes, shorter keys are padded with zeros */
+static inline uint64_t prefixOf(const char *key) {
+    uint64_t prefix = 0;
+    for (int index = 0; index < 8 && key[index]; index++)
+        prefix |= (uint64_t) (unsigned char) key[index] << (56 - 8 * index);
+
+    return prefix;
+}
+
+/** Returns the first position whose prefix is not less than the given one, without a data-dependent branch */
+static unsigned long int searchPrefix(const uint64_t *prefixes, unsigned long int count, uint64_t prefix) {
+    if (!count)
+        return 0;
+
+    const uint64_t *base = prefixes;
+    while (count > 1) {
+        unsigned long int half = count / 2;
+        base = base[half] < prefix ? base + half : base;
+        count -= half;
+    }
+
+    return (unsigned long int) (base - prefixes) + (*base < prefix);
+}
+
+/** Returns the position of the first key that is not less than the given one */
+static unsigned long int lowerBound(Private *private, const char *key, uint64_t prefix) {
+    unsigned long int low = searchPrefix(private->prefixes, private->mapSize, prefix);
+    unsigned long int high = prefix == UINT64_MAX ? private->mapSize :
+        low + searchPrefix(private->prefixes + low, private->mapSize - low, prefix + 1);
+
+    while (low < high) {
+        unsigned long int middle = low + (high - low) / 2;
+
+        if (strcmp(private->entries[middle].key, key) < 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+static inline bool isKeyAt(Private *private, unsigned long int index, const char *key, uint64_t prefix) {
+    return index < private->mapSize && private->prefixes[index] == prefix &&
+        !strcmp(private->entries[index].key, key);
+}
+
+static void ensureCapacity(Private *private, unsigned long int capacity) {
+    if (capacity <= private->capacity)
+        return;
+
+    unsigned long int newCapacity = private->capacity ? private->capacity : MIN_CAPACITY;
+    while (newCapacity < capacity)
+        newCapacity += newCapacity >> 1;
+
+    private->prefixes = (uint64_t *) realloc(private->prefixes, newCapacity * sizeof(uint64_t));
+    private->entries = (struct entry *) realloc(private->entries, newCapacity * sizeof(struct entry));
+    private->capacity = newCapacity;
+}
+
+static char *copyKey(const char *key) {
+    size_t size = strlen(key) + 1;
+    return (char *) memcpy(malloc(size), key, size);
+}
+
+static void clearEntries(Private *private) {
+    for (unsigned long int index = 0; index < private->mapSize; index++)
+        free(private->entries[index].key);
+
+    private->mapSize = 0;
+}
+
+/** Used by buildFrom to sort once, ties are broken by the original position */
+struct buildEntry {
+    uint64_t prefix;
+    char *key;
+    void *value;
+    unsigned long int position;
+};
+
+static int compareBuildEntries(const void *a, const void *b) {
+    const struct buildEntry *left = (const struct buildEntry *) a;
+    const struct buildEntry *right = (const struct buildEntry *) b;
+
+    if (left->prefix != right->prefix)
+        return left->prefix < right->prefix ? -1 : 1;
+
+    int comparison = strcmp(left->key, right->key);
+    if (comparison)
+        return comparison;
+
+    return (left->position > right->position) - (left->position < right->position);
+}
+
+/** Replaces the content with the given pairs, sorting them once; of equal keys the last one is kept */
+extern void __CComp_SortedArrayMap_buildFrom(void *_this, char **keys, void **values, unsigned long int count) {
+    Private *private = (Private *) this->_private;
+
+    clearEntries(private);
+    ensureCapacity(private, count);
+
+    struct buildEntry *build = (struct buildEntry *) malloc((count ? count : 1) * sizeof(struct buildEntry));
+    for (unsigned long int index = 0; index < count; index++) {
+        build[index].prefix = prefixOf(keys[index]);
+        build[index].key = keys[index];
+        build[index].value = values[index];
+        build[index].position = index;
+    }
+
+    qsort(build, count, sizeof(struct buildEntry), &compareBuildEntries);
+
+    for (unsigned long int index = 0; index < count; index++) {
+        if (index + 1 < count && build[index].prefix == build[index + 1].prefix &&
+            !strcmp(build[index].key, build[index + 1].key))
+            continue;
+
+        private->prefixes[private->mapSize] = build[index].prefix;
+        private->entries[private->mapSize].key = copyKey(build[index].key);
+        private->entries[private->mapSize].value = build[index].value;
+        private->mapSize++;
+    }
+
+    free(build);
+}
+
+/** Returns the greatest key that is not greater than the given one, or NULL */
+extern char *__CComp_SortedArrayMap_floorKey(void *_this, char *key) {
+    Private *private = (Private *) this->_private;
+
+    uint64_t prefix = prefixOf(key);
+    unsigned long int index = lowerBound(private, key, prefix);
+
+    if (isKeyAt(private, index, key, prefix))
+        return private->entries[index].key;
+
+    return index ? private->entries[index - 1].key : NULL;
+}
+
+/** Returns the least key that is not less than the given one, or NULL */
+extern char *__CComp_SortedArrayMap_ceilingKey(void *_this, char *key) {
+    Private *private = (Private *) this->_private;
+    unsigned long int index = lowerBound(private, key, prefixOf(key));
+
+    return index < private->mapSize ? private->entries[index].key : NULL;
+}
+
+extern char *__CComp_SortedArrayMap_keyAt(void *_this, unsigned long int index) {
+    return ((Private *) this->_private)->entries[index].key;
+}
+
+extern void *__CComp_SortedArrayMap_valueAt(void *_this, unsigned long int index) {
+    return ((Private *) this->_private)->entries[index].value;
+}
+
+extern void __CComp_SortedArrayMap_implMap_remove(void *_this, char *key) {
+    Private *private = (Private *) this->_private;
+
+    uint64_t prefix = prefixOf(key);
+    unsigned long int index = lowerBound(private, key, prefix);
+    if (!isKeyAt(private, index, key, prefix))
+        return;
+
+    free(private->entries[index].key);
+
+    unsigned long int moved = private->mapSize - index - 1;
+    memmove(private->prefixes + index, private->prefixes + index + 1, moved * sizeof(uint64_t));
+    memmove(private->entries + index, private->entries + index + 1, moved * sizeof(struct entry));
+
+    private->mapSize--;
+}
+
+extern void __CComp_SortedArrayMap_implMap_set(void *_this, char *key, void *value) {
+    Private *private = (Private *) this->_private;
+
+    uint64_t prefix = prefixOf(key);
+    unsigned long int index = lowerBound(private, key, prefix);
+    if (isKeyAt(private, index, key, prefix)) {
+        private->entries[index].value = value;
+        return;
+    }
+
+    ensureCapacity(private, private->mapSize + 1);
+
+    unsigned long int moved = private->mapSize - index;
+    memmove(private->prefixes + index + 1, private->prefixes + index, moved * sizeof(uint64_t));
+    memmove(private->entries + index + 1, private->entries + index, moved * sizeof(struct entry));
+
+    private->prefixes[index] = prefix;
+    private->entries[index].key = copyKey(key);
+    private->entries[index].value = value;
+
+    private->mapSize++;
+}
+
+extern void *__CComp_SortedArrayMap_implMap_get(void *_this, char *key) {
+    Private *private = (Private *) this->_private;
+
+    uint64_t prefix = prefixOf(key);
+    unsigned long int index = lowerBound(private, key, prefix);
+
+    return isKeyAt(private, index, key, prefix) ? private->entries[index].value : NULL;
+}
+
+extern unsigned long int __CComp_SortedArrayMap_implMap_length(void *_this) {
+    return ((Private *) this->_private)->mapSize;
+}
+
+/** Walks the entries in key order */
+extern void __CComp_SortedArrayMap_implMap_forEachEntry(void *_this, EntryCallback callback, void *context) {
+    Private *private = (Private *) this->_private;
+
+    for (unsigned long int index = 0; index < private->mapSize; index++)
+        if (!callback(private->entries[index].key, private->entries[index].value, context))
+            return;
+}
+
+static bool iteratorNext(MapIterator *iterator) {
+    Private *private = (Private *) ((SortedArrayMap *) iterator->map)->_private;
+    if (iterator->index >= private->mapSize)
+        return false;
+
+    iterator->key = private->entries[iterator->index].key;
+    iterator->value = private->entries[iterator->index++].value;
+    return true;
+}
+
+extern MapIterator __CComp_SortedArrayMap_implMap_iterator(void *_this) {
+    MapIterator iterator = { this, NULL, 0, &iteratorNext, NULL, NULL };
+    return iterator;
+}
+
+extern String *__CComp_SortedArrayMap_implObject_toString(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    String *result = CreateString("SortedArrayMap: [ ");
+    for (unsigned long int index = 0; index < private->mapSize; index++) {
+        result->class->add(result, private->entries[index].key);
+        result->class->add(result, ":");
+        result->class->addULong(result, (unsigned long int) private->entries[index].value);
+        if (index != private->mapSize - 1)
+            result->class->add(result, ", ");
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, private->mapSize);
+    result->class->add(result, ");");
+
+    return result;
+}
+
+extern void *__CComp_SortedArrayMap_implObject_copy(void *_this) {
+    SortedArrayMap *newMap = createSortedArrayMap();
+
+    Private *private = (Private *) this->_private;
+    Private *newPrivate = (Private *) newMap->_private;
+
+    ensureCapacity(newPrivate, private->mapSize);
+    memcpy(newPrivate->prefixes, private->prefixes, private->mapSize * sizeof(uint64_t));
+    for (unsigned long int index = 0; index < private->mapSize; index++) {
+        newPrivate->entries[index].key = copyKey(private->entries[index].key);
+        newPrivate->entries[index].value = private->entries[index].value;
+    }
+
+    newPrivate->mapSize = private->mapSize;
+
+    return newMap;
+}
+
+extern SortedArrayMap *createSortedArrayMap() {
+    SortedArrayMap *newMap = (SortedArrayMap *) malloc(sizeof(SortedArrayMap));
+
+    Private *private   = (Private *) malloc(sizeof(Private));
+    private->prefixes  = NULL;
+    private->entries   = NULL;
+    private->mapSize   = 0;
+    private->capacity  = 0;
+
+    newMap->_private = private;
+    newMap->class    = &ClassSortedArrayMap;
+    newMap->_class   = &classSortedArrayMap;
+
+    return newMap;
+}
+
+extern void __CComp_Cls_SortedArrayMap_delete(void *_this) {
+    Private *private = (Private *) this->_private;
+
+    clearEntries(private);
+    free(private->prefixes);
+    free(private->entries);
+    free(private);
+    free(this);
+}
+
+ClassSortedArrayMapType ClassSortedArrayMap = {
+    &__CComp_SortedArrayMap_buildFrom,
+    &__CComp_SortedArrayMap_floorKey,
+    &__CComp_SortedArrayMap_ceilingKey,
+    &__CComp_SortedArrayMap_keyAt,
+    &__CComp_SortedArrayMap_valueAt,
+    {
+        INTERFACE_MAP,
+        &__CComp_SortedArrayMap_implMap_remove,
+        &__CComp_SortedArrayMap_implMap_set,
+        &__CComp_SortedArrayMap_implMap_get,
+        &__CComp_SortedArrayMap_implMap_length,
+        &__CComp_SortedArrayMap_implMap_forEachEntry,
+        &__CComp_SortedArrayMap_implMap_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_SortedArrayMap_implObject_toString,
+            &__CComp_SortedArrayMap_implObject_copy
+        }
+    }
+};
+
+Class classSortedArrayMap = {
+    .classType = CLASS_SORTED_ARRAY_MAP,
+    .delete    = &__CComp_Cls_SortedArrayMap_delete
+};
@@ -0,0 +1,169 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "ccomponents.h"
+
+#define this ((SpscQueue *) _this)
+
+#define CACHE_LINE 64
+
+/**
+ * Bounded ring for one producer and one consumer. Each side keeps its own
+ * index and a cached copy of the other one on its own cache line, so the
+ * shared index is only read when the cached one says the ring is full or
+ * empty.
+ */
+typedef struct _spsc_queue_private {
+    _Alignas(CACHE_LINE) atomic_ulong head;
+    unsigned long cachedTail;
+    _Alignas(CACHE_LINE) atomic_ulong tail;
+    unsigned long cachedHead;
+    _Alignas(CACHE_LINE) unsigned long mask;
+    void **values;
+} Private;
+
+/** Must only be called from the producer thread, returns false if the queue is full */
+extern bool __CComp_SpscQueue_offer(void *_this, void *value) {
+
+    Private *private = (Private *) this->_private;
+    unsigned long tail = atomic_load_explicit(&private->tail, memory_order_relaxed);
+
+    if (tail - private->cachedHead > private->mask) {
+        private->cachedHead = atomic_load_explicit(&private->head, memory_order_acquire);
+        if (tail - private->cachedHead > private->mask)
+            return false;
+    }
+
+    private->values[tail & private->mask] = value;
+    atomic_store_explicit(&private->tail, tail + 1, memory_order_release);
+
+    return true;
+
+}
+
+/** Must only be called from the consumer thread, returns NULL if the queue is empty */
+extern void *__CComp_SpscQueue_poll(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    unsigned long head = atomic_load_explicit(&private->head, memory_order_relaxed);
+
+    if (head == private->cachedTail) {
+        private->cachedTail = atomic_load_explicit(&private->tail, memory_order_acquire);
+        if (head == private->cachedTail)
+            return NULL;
+    }
+
+    void *value = private->values[head & private->mask];
+    atomic_store_explicit(&private->head, head + 1, memory_order_release);
+
+    return value;
+
+}
+
+extern unsigned long int __CComp_SpscQueue_size(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    unsigned long head = atomic_load_explicit(&private->head, memory_order_acquire);
+    unsigned long tail = atomic_load_explicit(&private->tail, memory_order_acquire);
+
+    return tail - head > private->mask + 1 ? 0 : tail - head;
+
+}
+
+extern unsigned long int __CComp_SpscQueue_capacity(void *_this) {
+
+    return ((Private *) this->_private)->mask + 1;
+}
+
+String *__CComp_SpscQueue_implObject_toString(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    unsigned long head = atomic_load(&private->head);
+    unsigned long tail = atomic_load(&private->tail);
+
+    String *result = CreateString("SpscQueue: [ ");
+    for (unsigned long index = head; index != tail; index++) {
+
+        result->class->addULong(result,
+            (unsigned long) private->values[index & private->mask]);
+        if (index != tail - 1)
+            result->class->add(result, ", ");
+
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, tail - head);
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+/** Must not run while the consumer polls */
+extern void *__CComp_SpscQueue_implObject_copy(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    SpscQueue *result = createSpscQueue(private->mask + 1);
+
+    unsigned long head = atomic_load(&private->head);
+    unsigned long tail = atomic_load(&private->tail);
+    for (unsigned long index = head; index != tail; index++)
+        __CComp_SpscQueue_offer(result, private->values[index & private->mask]);
+
+    return result;
+
+}
+
+/** The capacity is rounded up to a power of two */
+extern SpscQueue *createSpscQueue(unsigned long int capacity) {
+
+    unsigned long size = 1;
+    while (size < capacity)
+        size <<= 1;
+
+    SpscQueue *newQueue = (SpscQueue *) malloc(sizeof(SpscQueue));
+    Private *private = (Private *) aligned_alloc(CACHE_LINE, sizeof(Private));
+
+    atomic_init(&private->head, 0);
+    atomic_init(&private->tail, 0);
+    private->cachedHead = 0;
+    private->cachedTail = 0;
+    private->mask = size - 1;
+    private->values = (void **) malloc(size * sizeof(void *));
+
+    newQueue->_private = private;
+    newQueue->class = &ClassSpscQueue;
+    newQueue->_class = &classSpscQueue;
+
+    return newQueue;
+
+}
+
+extern void __CComp_Cls_SpscQueue_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    free(private->values);
+    free(private);
+    free(this);
+
+}
+
+ClassSpscQueueType ClassSpscQueue = {
+    &__CComp_SpscQueue_offer,
+    &__CComp_SpscQueue_poll,
+    &__CComp_SpscQueue_size,
+    &__CComp_SpscQueue_capacity,
+    {
+        INTERFACE_CCOBJECT,
+        &__CComp_SpscQueue_implObject_toString,
+        &__CComp_SpscQueue_implObject_copy
+    }
+};
+
+Class classSpscQueue = {
+    .classType = CLASS_SPSC_QUEUE,
+    .delete    = &__CComp_Cls_SpscQueue_delete
+};
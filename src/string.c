@@ -1,5 +1,3 @@
-#include <math.h>
-
 #ifndef _WIN32
 #include <regex.h>
 #endif
@@ -14,42 +12,61 @@
 #define P_SIZE sizeof(intptr_t)
 #define this ((String *) _this)
 
+/** length excludes the terminating zero, capacity includes it */
 typedef struct _string_private {
     char *stringValue;
+    size_t length;
+    size_t capacity;
 } Private;
 
+/** Replaces the buffer with one holding the given value */
+static void assign(Private *private, const char *value, size_t length) {
+    private->stringValue = (char *) malloc(length + 1);
+    private->length = length;
+    private->capacity = length + 1;
+
+    memcpy(private->stringValue, value, length);
+    private->stringValue[length] = '\0';
+}
+
 extern char *__CComp_String_get(void *_this) {
     Private *private = (Private *) this->_private;
     return private->stringValue;
 }
 
 extern void __CComp_String_set(void *_this, char *value) {
-    int memSize = (int) (sizeof(char) * strlen(value));
-
-    free(((Private *) this->_private)->stringValue);
-
-    Private *stringValue = (Private *) this->_private;
-    stringValue->stringValue = (char *) malloc((size_t) memSize + 1);
+    Private *private = (Private *) this->_private;
+    char *oldValue = private->stringValue;
 
-    memcpy(stringValue->stringValue, value, (size_t) memSize);
-    memcpy(stringValue->stringValue + memSize, "\0", 1);
+    // The value may point into the current buffer
+    assign(private, value, strlen(value));
+    free(oldValue);
 }
 
+/** Grows the buffer geometrically, so that building a string by appending takes linear time */
 extern void __CComp_String_add(void *_this, char *value) {
-    int aSize = (int) (sizeof(char) * strlen(this->class->getValue(this)));
-    int bSize = (int) (sizeof(char) * strlen(value));
-
-    char *aDump = (char *) malloc((size_t) aSize);
-    memcpy(aDump, this->class->getValue(this), (size_t) aSize);
-
     Private *private = (Private *) this->_private;
-    private->stringValue = (char *) malloc((size_t) (aSize + bSize) + 1);
- 
-    memcpy(private->stringValue, aDump, (size_t) aSize);
-    memcpy(private->stringValue + aSize, value, (size_t) bSize);
-    memcpy(private->stringValue + aSize + bSize, "\0", 1);
-
-    free(aDump);
+    size_t valueLength = strlen(value);
+    size_t required = private->length + valueLength + 1;
+
+    if (required > private->capacity) {
+        size_t capacity = private->capacity * 2;
+        if (capacity < required)
+            capacity = required;
+
+        // A fresh buffer keeps the value readable when it points into the old one
+        char *grown = (char *) malloc(capacity);
+        memcpy(grown, private->stringValue, private->length);
+        memcpy(grown + private->length, value, valueLength);
+
+        free(private->stringValue);
+        private->stringValue = grown;
+        private->capacity = capacity;
+    } else
+        memmove(private->stringValue + private->length, value, valueLength);
+
+    private->length += valueLength;
+    private->stringValue[private->length] = '\0';
 }
 
 extern String *__CComp_String_sub(void *_this, int begin, int end) {
@@ -160,7 +177,7 @@ extern StringMatch *__CComp_String_match(void *_this, char *regex, int maxMatche
 
 extern ArrayList *__CComp_String_split(void *_this, char *regex) {
     StringMatch *match = this->class->match(this, regex, 1);
-    ArrayList *result = CreateArrayList((int) sizeof(String *));
+    ArrayList *result = CreateArrayList();
 
     String *copy = this->class->sub(this, 0, this->class->length(this));
     while (match->begin != -1) {
@@ -229,7 +246,7 @@ extern char __CComp_String_charAt(void *_this, int index) {
 }
 
 extern int __CComp_String_stringLength(void *_this) {
-    return (int) strlen(this->class->getValue(this));
+    return (int) ((Private *) this->_private)->length;
 }
 
 extern bool __CComp_String_equals(void *_this, String *subject) {
@@ -260,35 +277,23 @@ extern String *createStringNull(void *value) {
 }
 
 extern String *createStringChar(char *value) {
-    int memSize = (int) (sizeof(char) * strlen(value));
-
     String *newString = createStringNull(NULL);
-    newString->_private = malloc(sizeof(Private *));
-
-    Private *private = (Private *) newString->_private;
-    private->stringValue = (char *) malloc((size_t) memSize + 1);
+    newString->_private = malloc(sizeof(Private));
 
-    memcpy(private->stringValue, value, (size_t) memSize);
-    memcpy(private->stringValue + memSize, "\0", 1);
+    assign((Private *) newString->_private, value, strlen(value));
 
     return newString;
 }
 
 static String *__createStringLong(long int number, bool isUnsigned) {
+    char digits[24];
+    int length = isUnsigned ? snprintf(digits, sizeof(digits), "%lu", (unsigned long int) number)
+                            : snprintf(digits, sizeof(digits), "%ld", number);
+
     String *newString = createStringNull(NULL);
     newString->_private = malloc(sizeof(Private));
-    Private *private = (Private *) newString->_private;
-
-    int length = 1;
-    int divisior = 10;
-    while (floor((double) number / divisior) > 0) {
-        length++;
-        divisior *= 10;
-    }
-
-    private->stringValue = malloc(sizeof(char) * (size_t) length + 1);
 
-    sprintf(private->stringValue, isUnsigned ? "%lu" : "%ld", number);
+    assign((Private *) newString->_private, digits, (size_t) length);
 
     return newString;
 }
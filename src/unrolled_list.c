@@ -0,0 +1,361 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ccomponents.h"
+
+#define P_SIZE sizeof(intptr_t)
+#define this ((UnrolledList *) _this)
+
+#define NODE_CAPACITY 32
+
+/** Values of a node occupy values[offset] .. values[offset + count - 1] */
+struct node {
+    struct node *previous;
+    struct node *next;
+    unsigned int offset;
+    unsigned int count;
+    void *values[NODE_CAPACITY];
+};
+
+typedef struct _unrolled_list_private {
+    struct node *firstNode, *lastNode;
+    unsigned long listSize;
+} Private;
+
+static struct node *createNode(unsigned int offset) {
+
+    struct node *node = malloc(sizeof(struct node));
+    node->previous = node->next = NULL;
+    node->offset = offset;
+    node->count = 0;
+
+    return node;
+
+}
+
+static void insertNodeAfter(Private *private, struct node *previous, struct node *node) {
+
+    node->previous = previous;
+    node->next = previous ? previous->next : private->firstNode;
+
+    if (node->previous)
+        node->previous->next = node;
+    else
+        private->firstNode = node;
+
+    if (node->next)
+        node->next->previous = node;
+    else
+        private->lastNode = node;
+
+}
+
+static void removeNode(Private *private, struct node *node) {
+
+    if (node->previous)
+        node->previous->next = node->next;
+    else
+        private->firstNode = node->next;
+
+    if (node->next)
+        node->next->previous = node->previous;
+    else
+        private->lastNode = node->previous;
+
+    free(node);
+
+}
+
+/** Finds the node holding the index, walking from the nearer end; *index becomes node-relative */
+static struct node *getNode(Private *private, unsigned long *index) {
+
+    if (*index < private->listSize >> 1) {
+        struct node *node = private->firstNode;
+        while (*index >= node->count) {
+            *index -= node->count;
+            node = node->next;
+        }
+
+        return node;
+    }
+
+    unsigned long fromEnd = private->listSize - *index;
+    struct node *node = private->lastNode;
+    while (fromEnd > node->count) {
+        fromEnd -= node->count;
+        node = node->previous;
+    }
+
+    *index = node->count - fromEnd;
+    return node;
+
+}
+
+extern void __CComp_UnrolledList_implList_add(void *_this, void *value) {
+
+    Private *private = (Private *) this->_private;
+    struct node *node = private->lastNode;
+
+    if (!node || node->offset + node->count == NODE_CAPACITY) {
+        node = createNode(0);
+        insertNodeAfter(private, private->lastNode, node);
+    }
+
+    node->values[node->offset + node->count++] = value;
+    private->listSize++;
+
+}
+
+/** Keeps nodes at least a quarter full by merging a sparse node into its neighbour */
+static void removeValue(Private *private, struct node *node, unsigned long index) {
+
+    void **values = node->values + node->offset;
+    memmove(values + index, values + index + 1,
+            (node->count - index - 1) * P_SIZE);
+    node->count--;
+    private->listSize--;
+
+    if (!node->count) {
+        removeNode(private, node);
+        return;
+    }
+
+    struct node *next = node->next;
+    if (node->count < NODE_CAPACITY / 4 && next && node->count + next->count <= NODE_CAPACITY) {
+        memmove(node->values, node->values + node->offset, node->count * P_SIZE);
+        memcpy(node->values + node->count, next->values + next->offset, next->count * P_SIZE);
+        node->offset = 0;
+        node->count += next->count;
+
+        removeNode(private, next);
+    }
+
+}
+
+extern void __CComp_UnrolledList_implList_remove
+            (void *_this, unsigned long index) {
+
+    Private *private = (Private *) this->_private;
+    struct node *node = getNode(private, &index);
+
+    removeValue(private, node, index);
+
+}
+
+extern void __CComp_UnrolledList_implList_set
+            (void *_this, unsigned long index, void *value) {
+
+    struct node *node = getNode((Private *) this->_private, &index);
+    node->values[node->offset + index] = value;
+}
+
+extern void *__CComp_UnrolledList_implList_get
+            (void *_this, unsigned long index) {
+
+    struct node *node = getNode((Private *) this->_private, &index);
+    return node->values[node->offset + index];
+}
+
+extern unsigned long __CComp_UnrolledList_implList_length(void *_this) {
+
+    return ((Private *) this->_private)->listSize;
+}
+
+/** The cursor is the node of the value returned last, the index is the position after it */
+static bool iteratorHasNext(ListIterator *iterator) {
+
+    struct node *node = (struct node *) iterator->cursor;
+    return node && (iterator->index < node->count || node->next);
+}
+
+static void *iteratorNext(ListIterator *iterator) {
+
+    struct node *node = (struct node *) iterator->cursor;
+    if (iterator->index == node->count) {
+        node = iterator->cursor = node->next;
+        iterator->index = 0;
+    }
+
+    return node->values[node->offset + iterator->index++];
+
+}
+
+static void iteratorRemove(ListIterator *iterator) {
+
+    Private *private = (Private *) ((UnrolledList *) iterator->list)->_private;
+    struct node *node = (struct node *) iterator->cursor;
+
+    if (node->count == 1) {
+        iterator->cursor = node->next;
+        iterator->index = 0;
+        removeValue(private, node, 0);
+    } else
+        removeValue(private, node, --iterator->index);
+
+}
+
+extern ListIterator __CComp_UnrolledList_implList_iterator(void *_this) {
+
+    ListIterator iterator = {
+        this, ((Private *) this->_private)->firstNode, 0,
+        &iteratorHasNext, &iteratorNext, &iteratorRemove
+    };
+    return iterator;
+
+}
+
+String *__CComp_UnrolledList_implObject_toString(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    String *result = CreateString("UnrolledList: [ ");
+    for (struct node *node = private->firstNode; node; node = node->next) {
+        for (unsigned int index = 0; index < node->count; index++) {
+
+            result->class->addULong(result, (unsigned long) node->values[node->offset + index]);
+            if (node->next || index != node->count - 1)
+                result->class->add(result, ", ");
+
+        }
+    }
+
+    result->class->add(result, " ] (");
+    result->class->addULong(result, private->listSize);
+    result->class->add(result, ");");
+
+    return result;
+
+}
+
+/** The copy packs values into full nodes */
+extern void *__CComp_UnrolledList_implObject_copy(void *_this) {
+
+    UnrolledList *result = createUnrolledList();
+    Private *private = (Private *) this->_private;
+
+    for (struct node *node = private->firstNode; node; node = node->next) {
+        for (unsigned int index = 0; index < node->count; index++)
+            __CComp_UnrolledList_implList_add(result, node->values[node->offset + index]);
+    }
+
+    return result;
+
+}
+
+extern void __CComp_UnrolledList_addFirst(void *_this, void *value) {
+
+    Private *private = (Private *) this->_private;
+    struct node *node = private->firstNode;
+
+    if (!node || !node->offset) {
+        if (node && node->count < NODE_CAPACITY) {
+            memmove(node->values + NODE_CAPACITY - node->count, node->values, node->count * P_SIZE);
+            node->offset = NODE_CAPACITY - node->count;
+        } else {
+            node = createNode(NODE_CAPACITY);
+            insertNodeAfter(private, NULL, node);
+        }
+    }
+
+    node->values[--node->offset] = value;
+    node->count++;
+    private->listSize++;
+
+}
+
+extern void *__CComp_UnrolledList_getFirst(void *_this) {
+
+    struct node *node = ((Private *) this->_private)->firstNode;
+    return node ? node->values[node->offset] : NULL;
+}
+
+extern void *__CComp_UnrolledList_getLast(void *_this) {
+
+    struct node *node = ((Private *) this->_private)->lastNode;
+    return node ? node->values[node->offset + node->count - 1] : NULL;
+}
+
+extern void __CComp_UnrolledList_removeFirst(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    struct node *node = private->firstNode;
+    if (!node)
+        return;
+
+    node->offset++;
+    private->listSize--;
+    if (!--node->count)
+        removeNode(private, node);
+
+}
+
+extern void __CComp_UnrolledList_removeLast(void *_this) {
+
+    Private *private = (Private *) this->_private;
+    struct node *node = private->lastNode;
+    if (!node)
+        return;
+
+    private->listSize--;
+    if (!--node->count)
+        removeNode(private, node);
+
+}
+
+extern UnrolledList *createUnrolledList() {
+
+    UnrolledList *newUnrolledList = (UnrolledList *) malloc(sizeof(UnrolledList));
+    Private *private = (Private *) malloc(sizeof(Private));
+    private->listSize = 0;
+    private->firstNode = private->lastNode = NULL;
+    newUnrolledList->_private = private;
+    newUnrolledList->class = &ClassUnrolledList;
+    newUnrolledList->_class = &classUnrolledList;
+
+    return newUnrolledList;
+
+}
+
+extern void __CComp_Cls_UnrolledList_delete(void *_this) {
+
+    Private *private = (Private *) this->_private;
+
+    struct node *cursor = private->firstNode;
+    while (cursor) {
+        struct node *next = cursor->next;
+        free(cursor);
+        cursor = next;
+    }
+
+    free(private);
+    free(this);
+
+}
+
+ClassUnrolledListType ClassUnrolledList = {
+    &__CComp_UnrolledList_addFirst,
+    &__CComp_UnrolledList_getFirst,
+    &__CComp_UnrolledList_getLast,
+    &__CComp_UnrolledList_removeFirst,
+    &__CComp_UnrolledList_removeLast,
+    {
+        INTERFACE_LIST,
+        &__CComp_UnrolledList_implList_add,
+        &__CComp_UnrolledList_implList_remove,
+        &__CComp_UnrolledList_implList_set,
+        &__CComp_UnrolledList_implList_get,
+        &__CComp_UnrolledList_implList_length,
+        &__CComp_UnrolledList_implList_iterator,
+        {
+            INTERFACE_CCOBJECT,
+            &__CComp_UnrolledList_implObject_toString,
+            &__CComp_UnrolledList_implObject_copy
+        }
+    }
+};
+
+Class classUnrolledList = {
+    .classType = CLASS_UNROLLED_LIST,
+    .delete    = &__CComp_Cls_UnrolledList_delete
+};
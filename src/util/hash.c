@@ -0,0 +1,49 @@
+#include <string.h>
+
+#include "hash.h"
+
+static const uint64_t PRIME_1 = 0x9E3779B97F4A7C15ULL;
+static const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+
+static inline uint64_t read64(const unsigned char *data) {
+    uint64_t word;
+    memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+static inline uint64_t rotate(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/** Murmur3 finalizer */
+static inline uint64_t avalanche(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+uint64_t _hash_bytes(const void *data, unsigned long int length) {
+    return _hash_bytes_seeded(data, length, 0);
+}
+
+uint64_t _hash_bytes_seeded(const void *data, unsigned long int length, uint64_t seed) {
+    const unsigned char *bytes = (const unsigned char *) data;
+    uint64_t hash = PRIME_3 ^ avalanche(seed) ^ (length * PRIME_1);
+
+    // Eight bytes per step, read unaligned
+    for (; length >= 8; bytes += 8, length -= 8)
+        hash = rotate(hash ^ (read64(bytes) * PRIME_2), 31) * PRIME_1;
+
+    uint64_t tail = 0;
+    for (unsigned long int index = 0; index < length; index++)
+        tail |= (uint64_t) bytes[index] << (index * 8);
+
+    if (length)
+        hash = rotate(hash ^ (tail * PRIME_2), 31) * PRIME_1;
+
+    return avalanche(hash);
+}
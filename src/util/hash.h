@@ -0,0 +1,15 @@
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include <stdint.h>
+
+/**
+ * Returns a 64-bit hash of the bytes whose every bit depends on all input bits,
+ * so that both the low and the high bits can be used separately
+ */
+uint64_t _hash_bytes(const void *data, unsigned long int length);
+
+/** Different seeds give independent hash functions */
+uint64_t _hash_bytes_seeded(const void *data, unsigned long int length, uint64_t seed);
+
+#endif /* __HASH_H__ */
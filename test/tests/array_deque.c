@@ -0,0 +1,146 @@
+#include <assert.h>
+
+#include "../../src/ccomponents.h"
+
+int main(int argc, char **argv) {
+    
+    // Testing constructor
+    ArrayDeque *deque = CreateArrayDeque();
+    assert(!ClassArrayDeque._impl_List.length(deque));
+    assert(!ClassArrayDeque.getFirst(deque) && !ClassArrayDeque.getLast(deque));
+
+    // Testing push()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+
+    for (int x = 0; x < 4; x++)
+        ClassArrayDeque._impl_List.add(deque, testData[x]);
+
+    assert(ClassArrayDeque._impl_List.length(deque) == 4);
+
+    for (int x = 0; x < 4; x++) 
+        assert(ClassArrayDeque._impl_List.get(deque, x) == testData[x]);
+
+    // Testing set() & get()
+    ClassArrayDeque._impl_List.set(deque, 2, testData[0]);
+
+    assert(ClassArrayDeque._impl_List.length(deque) == 4);
+    assert(ClassArrayDeque._impl_List.get(deque, 2) == ClassArrayDeque
+        ._impl_List.get(deque, 0));
+
+    // Testing remove() & get()
+    ClassArrayDeque._impl_List.remove(deque, 0);
+
+    assert(ClassArrayDeque._impl_List.length(deque) == 3);
+    assert(ClassArrayDeque._impl_List.get(deque, 0) == testData[1] &&
+           ClassArrayDeque._impl_List.get(deque, 1) == testData[0] &&
+           ClassArrayDeque._impl_List.get(deque, 2) == testData[3] );
+
+    // Testing toString()
+    String *dequeAsString = ClassArrayDeque._impl_List
+        ._impl_CCObject.toString(deque);
+    delete(dequeAsString);
+
+    // Testing addFirst
+    ClassArrayDeque.addFirst(deque, testData[2]);
+    assert(ClassArrayDeque._impl_List.length(deque) == 4);
+    assert(ClassArrayDeque._impl_List.get(deque, 0) == testData[2] &&
+           ClassArrayDeque._impl_List.get(deque, 1) == testData[1] &&
+           ClassArrayDeque._impl_List.get(deque, 2) == testData[0] &&
+           ClassArrayDeque._impl_List.get(deque, 3) == testData[3] );
+
+    // Testing copy() of a wrapped ring
+    ArrayDeque *copy = ClassArrayDeque._impl_List._impl_CCObject.copy(deque);
+    assert(ClassArrayDeque._impl_List.length(copy) == 4);
+
+    for (int index = 0; index < 4; index++)
+        assert(ClassArrayDeque._impl_List.get(copy, index) == 
+               ClassArrayDeque._impl_List.get(deque, index));
+
+    // Testing iterator() & List_forEachRemove()
+    ListIterator iterator = ClassArrayDeque._impl_List.iterator(deque);
+    for (unsigned long int index = 0; index < ClassArrayDeque._impl_List.length(deque); index++) {
+        assert(iterator.hasNext(&iterator));
+        assert(iterator.next(&iterator) == ClassArrayDeque._impl_List.get(deque, index));
+    }
+    assert(!iterator.hasNext(&iterator));
+
+    // Values 4 .. 15 with the head wrapped around the end of the ring
+    ArrayDeque *ring = CreateArrayDeque();
+    for (unsigned long int index = 0; index < 6; index++)
+        ClassArrayDeque._impl_List.add(ring, (void *) (index + 10));
+    for (unsigned long int index = 0; index < 6; index++)
+        ClassArrayDeque.addFirst(ring, (void *) (9 - index));
+
+    unsigned long int expected = 4;
+    List_forEach(ring, item, {
+        assert(item == (void *) expected++);
+    });
+    assert(expected == 16);
+
+    // Removals in the front half move the head back across the wrap, the others shift the tail
+    List_forEach(ring, item, {
+        if ((unsigned long int) item % 2)
+            List_forEachRemove(item);
+    });
+
+    assert(ClassArrayDeque._impl_List.length(ring) == 6);
+    for (unsigned long int index = 0; index < 6; index++)
+        assert(ClassArrayDeque._impl_List.get(ring, index) == (void *) (4 + 2 * index));
+
+    List_forEach(ring, item, {
+        if ((unsigned long int) item < 14)
+            List_forEachRemove(item);
+    });
+
+    assert(ClassArrayDeque._impl_List.length(ring) == 1);
+    assert(ClassArrayDeque.getFirst(ring) == (void *) 14 && ClassArrayDeque.getLast(ring) == (void *) 14);
+    delete(ring);
+
+    // Testing getFirst & getLast
+    assert(ClassArrayDeque.getFirst(deque) == testData[2]);
+    assert(ClassArrayDeque.getLast(deque) == testData[3]);
+
+    // Testing removeFirst & removeLast
+    ClassArrayDeque.removeFirst(deque);
+    assert(ClassArrayDeque.getFirst(deque) == testData[1]);
+    assert(ClassArrayDeque._impl_List.length(deque) == 3);
+
+    ClassArrayDeque.removeLast(deque);
+    assert(ClassArrayDeque.getLast(deque) == testData[0]);
+    assert(ClassArrayDeque._impl_List.length(deque) == 2);
+
+    // Testing growth while the ring is wrapped & FIFO usage
+    for (unsigned long index = 0; index < 1000; index++) {
+        ClassArrayDeque.addFirst(copy, (void *) (index + 1));
+        ClassArrayDeque._impl_List.add(copy, (void *) (index + 1));
+    }
+
+    assert(ClassArrayDeque._impl_List.length(copy) == 2004);
+    assert(ClassArrayDeque.getFirst(copy) == (void *) 1000);
+    assert(ClassArrayDeque.getLast(copy) == (void *) 1000);
+    assert(ClassArrayDeque._impl_List.get(copy, 1000) == testData[2]);
+    assert(ClassArrayDeque._impl_List.get(copy, 1003) == testData[3]);
+
+    ClassArrayDeque._impl_List.remove(copy, 1500);
+    assert(ClassArrayDeque._impl_List.get(copy, 1500) == (void *) 498);
+    ClassArrayDeque._impl_List.remove(copy, 10);
+    assert(ClassArrayDeque._impl_List.get(copy, 10) == (void *) 989);
+    assert(ClassArrayDeque.getFirst(copy) == (void *) 1000);
+
+    while (ClassArrayDeque._impl_List.length(copy))
+        ClassArrayDeque.removeFirst(copy);
+    ClassArrayDeque.removeFirst(copy);
+    assert(!ClassArrayDeque.getFirst(copy));
+
+    List_forEach(deque, item, {
+        assert(item);
+    });
+
+    delete(copy);
+    delete(deque);
+
+    return 0;
+}
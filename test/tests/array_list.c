@@ -4,11 +4,16 @@
 
 #include "../../src/ccomponents.h"
 
+static int compareNumbers(void *a, void *b) {
+    return (a > b) - (a < b);
+}
+
 int main(int argc, char **argv) {
     
     // Testing constructor
     ArrayList *list = CreateArrayList();
     assert(ClassArrayList._impl_List.length(list) == 0);
+    assert(ClassArrayList.capacity(list) == 8);
 
     // Testing push()
     char *testData[4] =
@@ -66,6 +71,180 @@ int main(int argc, char **argv) {
         assert(item != NULL);
     });
 
+    // Testing iterator() & List_forEachRemove()
+    ListIterator iterator = ClassArrayList._impl_List.iterator(copy);
+    for (unsigned long int index = 0; index < ClassArrayList._impl_List.length(copy); index++) {
+        assert(iterator.hasNext(&iterator));
+        assert(iterator.next(&iterator) == ClassArrayList._impl_List.get(copy, index));
+    }
+    assert(!iterator.hasNext(&iterator));
+
+    // Removing neighbours, the first and the last element shifts the rest under the iterator
+    ArrayList *filtered = CreateArrayList();
+    for (unsigned long int index = 0; index < 10; index++)
+        ClassArrayList._impl_List.add(filtered, (void *) index);
+
+    unsigned long int visited = 0;
+    List_forEach(filtered, item, {
+        visited++;
+        if ((unsigned long int) item < 3 || (unsigned long int) item > 6)
+            List_forEachRemove(item);
+    });
+
+    assert(visited == 10 && ClassArrayList._impl_List.length(filtered) == 4);
+    for (unsigned long int index = 0; index < 4; index++)
+        assert(ClassArrayList._impl_List.get(filtered, index) == (void *) (index + 3));
+
+    List_forEach(filtered, item, {
+        if (item)
+            List_forEachRemove(item);
+    });
+    assert(!ClassArrayList._impl_List.length(filtered));
+    delete(filtered);
+
+    // Testing reserve() & capacity() & shrinkToFit()
+    ClassArrayList.reserve(copy, 1000);
+    assert(ClassArrayList.capacity(copy) >= 1000);
+
+    for (unsigned long int index = 0; index < 994; index++)
+        ClassArrayList._impl_List.add(copy, (void *) index);
+
+    assert(ClassArrayList._impl_List.length(copy) == 1000);
+    assert(ClassArrayList.capacity(copy) == 1000);
+    assert(ClassArrayList._impl_List.get(copy, 999) == (void *) 993);
+
+    ClassArrayList._impl_List.add(copy, NULL);
+    assert(ClassArrayList.capacity(copy) > 1000);
+
+    ClassArrayList.shrinkToFit(copy);
+    assert(ClassArrayList.capacity(copy) == 1001);
+    assert(ClassArrayList._impl_List.get(copy, 5) == testDataFill[2]);
+
+    // Testing insertAt() & insertRange()
+    ClassArrayList.insertAt(list, 0, testDataFill[2]);
+    assert(ClassArrayList._impl_List.length(list) == 7);
+    assert(ClassArrayList._impl_List.get(list, 0) == testDataFill[2]);
+    assert(ClassArrayList._impl_List.get(list, 1) == testData[1]);
+
+    ClassArrayList.insertRange(list, 2, (void **) testDataFill, 3);
+    assert(ClassArrayList._impl_List.length(list) == 10);
+    assert(ClassArrayList._impl_List.get(list, 1) == testData[1] &&
+           ClassArrayList._impl_List.get(list, 2) == testDataFill[0] &&
+           ClassArrayList._impl_List.get(list, 4) == testDataFill[2] &&
+           ClassArrayList._impl_List.get(list, 5) == testData[0]);
+
+    // Testing removeRange()
+    ClassArrayList.removeRange(list, 0, 5);
+    assert(ClassArrayList._impl_List.length(list) == 5);
+    assert(ClassArrayList._impl_List.get(list, 0) == testData[0] &&
+           ClassArrayList._impl_List.get(list, 4) == testDataFill[2]);
+
+    // Testing truncate() & clear()
+    ClassArrayList.truncate(list, 2);
+    assert(ClassArrayList._impl_List.length(list) == 2);
+    assert(ClassArrayList._impl_List.get(list, 1) == testData[3]);
+
+    ClassArrayList.clear(list);
+    assert(ClassArrayList._impl_List.length(list) == 0);
+
+    // Testing swapRemove() & pop()
+    ClassArrayList.include(list, (void **) testData, 4);
+    ClassArrayList.swapRemove(list, 1);
+    assert(ClassArrayList._impl_List.length(list) == 3);
+    assert(ClassArrayList._impl_List.get(list, 0) == testData[0] &&
+           ClassArrayList._impl_List.get(list, 1) == testData[3] &&
+           ClassArrayList._impl_List.get(list, 2) == testData[2]);
+
+    ClassArrayList.swapRemove(list, 2);
+    assert(ClassArrayList._impl_List.length(list) == 2);
+
+    assert(ClassArrayList.pop(list) == testData[3]);
+    assert(ClassArrayList.pop(list) == testData[0]);
+    assert(ClassArrayList.pop(list) == NULL);
+    assert(ClassArrayList._impl_List.length(list) == 0);
+
+    // Testing spilling from the inline buffer and moving back to it
+    for (unsigned long int index = 0; index < 20; index++)
+        ClassArrayList._impl_List.add(list, (void *) index);
+
+    assert(ClassArrayList.capacity(list) > 8);
+    ClassArrayList.truncate(list, 3);
+    ClassArrayList.shrinkToFit(list);
+    assert(ClassArrayList.capacity(list) == 8);
+    assert(ClassArrayList._impl_List.get(list, 2) == (void *) 2);
+
+    // Testing copy-on-write copies
+    ClassArrayList.clear(list);
+    for (unsigned long int index = 0; index < 100; index++)
+        ClassArrayList._impl_List.add(list, (void *) index);
+
+    ArrayList *snapshot = ClassArrayList._impl_List._impl_CCObject.copy(list);
+    ArrayList *secondSnapshot = ClassArrayList._impl_List._impl_CCObject.copy(snapshot);
+
+    ClassArrayList._impl_List.set(list, 0, (void *) 1000);
+    ClassArrayList._impl_List.add(snapshot, (void *) 100);
+    assert(ClassArrayList._impl_List.get(list, 0) == (void *) 1000);
+    assert(ClassArrayList._impl_List.get(snapshot, 0) == (void *) 0);
+    assert(ClassArrayList._impl_List.get(secondSnapshot, 0) == (void *) 0);
+    assert(ClassArrayList._impl_List.length(list) == 100);
+    assert(ClassArrayList._impl_List.length(snapshot) == 101);
+    assert(ClassArrayList._impl_List.length(secondSnapshot) == 100);
+
+    delete(snapshot);
+    ClassArrayList.swapRemove(secondSnapshot, 0);
+    assert(ClassArrayList._impl_List.get(secondSnapshot, 0) == (void *) 99);
+    assert(ClassArrayList._impl_List.get(list, 99) == (void *) 99);
+    delete(secondSnapshot);
+
+    // Testing sort()
+    ClassArrayList.clear(list);
+    unsigned long int seed = 42;
+    for (unsigned long int index = 0; index < 10000; index++) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ClassArrayList._impl_List.add(list, (void *) ((seed >> 33) % 5000));
+    }
+
+    ClassArrayList.sort(list, &compareNumbers);
+    for (unsigned long int index = 1; index < 10000; index++)
+        assert(ClassArrayList._impl_List.get(list, index - 1) <= ClassArrayList._impl_List.get(list, index));
+
+    ClassArrayList.clear(list);
+    for (unsigned long int index = 0; index < 1000; index++)
+        ClassArrayList._impl_List.add(list, (void *) (index % 2 ? index : 1000 - index));
+
+    ClassArrayList.sort(list, &compareNumbers);
+    for (unsigned long int index = 1; index < 1000; index++)
+        assert(ClassArrayList._impl_List.get(list, index - 1) <= ClassArrayList._impl_List.get(list, index));
+
+    // Testing parallelSort()
+    for (unsigned int threads = 1; threads <= 5; threads += 2) {
+        ClassArrayList.clear(list);
+        for (unsigned long int index = 0; index < 300000; index++) {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            ClassArrayList._impl_List.add(list, (void *) ((seed >> 33) % 100000));
+        }
+
+        ClassArrayList.parallelSort(list, &compareNumbers, threads);
+        assert(ClassArrayList._impl_List.length(list) == 300000);
+        for (unsigned long int index = 1; index < 300000; index++)
+            assert(ClassArrayList._impl_List.get(list, index - 1) <= ClassArrayList._impl_List.get(list, index));
+    }
+
+    // Testing binarySearch() & insertSorted()
+    ClassArrayList.clear(list);
+    for (unsigned long int index = 0; index < 100; index += 2)
+        ClassArrayList._impl_List.add(list, (void *) index);
+
+    assert(ClassArrayList.binarySearch(list, (void *) 42, &compareNumbers) == 21);
+    assert(ClassArrayList.binarySearch(list, (void *) 43, &compareNumbers) == -1);
+    assert(ClassArrayList.binarySearch(list, (void *) 100, &compareNumbers) == -1);
+
+    assert(ClassArrayList.insertSorted(list, (void *) 43, &compareNumbers) == 22);
+    assert(ClassArrayList.insertSorted(list, (void *) 1000, &compareNumbers) == 51);
+    assert(ClassArrayList.insertSorted(list, (void *) 0, &compareNumbers) == 1);
+    assert(ClassArrayList._impl_List.length(list) == 53);
+    assert(ClassArrayList._impl_List.get(list, 23) == (void *) 43);
+
     delete(copy);
     delete(list);
 
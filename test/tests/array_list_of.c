@@ -0,0 +1,98 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/ccomponents.h"
+
+typedef struct {
+    long int id;
+    double weight;
+    char tag[4];
+} Record;
+
+int main(int argc, char **argv) {
+
+    // Testing constructor
+    ArrayListOf *list = CreateArrayListOf(sizeof(Record));
+    assert(ClassArrayListOf._impl_List.length(list) == 0);
+    assert(ClassArrayListOf.elementSize(list) == sizeof(Record));
+
+    // Testing push() & at()
+    Record testData[4] =
+        {
+            { 1, 0.5, "Hel" }, { 2, 1.5, "lo " }, { 3, 2.5, "wor" }, { 4, 3.5, "ld!" }
+        };
+
+    for (int x = 0; x < 4; x++)
+        ClassArrayListOf.push(list, &testData[x]);
+
+    assert(ClassArrayListOf._impl_List.length(list) == 4);
+
+    for (int x = 0; x < 4; x++) {
+        Record *record = ClassArrayListOf.at(list, x);
+        assert(record->id == testData[x].id && !strcmp(record->tag, testData[x].tag));
+    }
+
+    Record *zeroed = ClassArrayListOf.push(list, NULL);
+    assert(zeroed->id == 0 && zeroed->weight == 0.0);
+    zeroed->id = 5;
+    assert(((Record *) ClassArrayListOf._impl_List.get(list, 4))->id == 5);
+
+    // Testing pop()
+    Record popped;
+    assert(ClassArrayListOf.pop(list, &popped));
+    assert(popped.id == 5);
+    assert(ClassArrayListOf._impl_List.length(list) == 4);
+
+    // Testing set() & remove()
+    ClassArrayListOf._impl_List.set(list, 2, &testData[0]);
+    assert(((Record *) ClassArrayListOf.at(list, 2))->id == 1);
+
+    Record blank;
+    memset(&blank, 0, sizeof(Record));
+    ClassArrayListOf._impl_List.set(list, 3, NULL);
+    assert(!memcmp(ClassArrayListOf.at(list, 3), &blank, sizeof(Record)));
+    ClassArrayListOf._impl_List.set(list, 3, &testData[3]);
+
+    ClassArrayListOf._impl_List.remove(list, 0);
+    assert(ClassArrayListOf._impl_List.length(list) == 3);
+    assert(((Record *) ClassArrayListOf.at(list, 0))->id == 2 &&
+           ((Record *) ClassArrayListOf.at(list, 1))->id == 1 &&
+           ((Record *) ClassArrayListOf.at(list, 2))->id == 4 );
+
+    // Testing pushRange() & copyRange()
+    ClassArrayListOf.reserve(list, 100);
+    assert(ClassArrayListOf.capacity(list) >= 100);
+
+    ClassArrayListOf.pushRange(list, testData, 4);
+    assert(ClassArrayListOf._impl_List.length(list) == 7);
+
+    Record copied[4];
+    ClassArrayListOf.copyRange(list, 3, 4, copied);
+    assert(!memcmp(copied, testData, sizeof(copied)));
+
+    ClassArrayListOf.shrinkToFit(list);
+    assert(ClassArrayListOf.capacity(list) == 7);
+
+    // Testing toString()
+    String *listAsString = ClassArrayListOf._impl_List._impl_CCObject.toString(list);
+    delete(listAsString);
+
+    // Testing copy()
+    ArrayListOf *copy = ClassArrayListOf._impl_List._impl_CCObject.copy(list);
+    assert(ClassArrayListOf._impl_List.length(copy) == 7);
+    assert(ClassArrayListOf.at(copy, 0) != ClassArrayListOf.at(list, 0));
+    assert(!memcmp(ClassArrayListOf.at(copy, 0), ClassArrayListOf.at(list, 0), sizeof(Record) * 7));
+
+    List_forEach(copy, item, {
+        assert(((Record *) item)->id > 0);
+    });
+
+    while (ClassArrayListOf.pop(copy, NULL));
+    assert(!ClassArrayListOf._impl_List.length(copy));
+
+    delete(copy);
+    delete(list);
+
+    return 0;
+}
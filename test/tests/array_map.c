@@ -1,9 +1,16 @@
 #include <assert.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "../../src/ccomponents.h"
 
+/** Adds the visited values to the sum behind the context, stopping at the key "9" */
+static bool sumUntilNine(char *key, void *value, void *context) {
+    *(unsigned long int *) context += (unsigned long int) value;
+    return strcmp(key, "9");
+}
+
 int main(int argc, char **argv) {
 
     // Testing constructor
@@ -45,7 +52,74 @@ int main(int argc, char **argv) {
            !(strcmp(ClassArrayMap._impl_Map.get(copy, "2"), testData[0])) &&
            !(strcmp(ClassArrayMap._impl_Map.get(copy, "3"), testData[3])) );
 
+    ClassArrayMap._impl_Map.remove(copy, "1");
+    assert(!(strcmp(ClassArrayMap._impl_Map.get(map, "1"), testData[1])));
     delete(copy);
+
+    // Testing insertion order through removal & compaction
+    ArrayMap *ordered = CreateArrayMap();
+    char key[32];
+    for (unsigned long int index = 0; index < 3000; index++) {
+        sprintf(key, "%lu", index);
+        ClassArrayMap._impl_Map.set(ordered, key, (void *) (index + 1));
+    }
+
+    for (unsigned long int index = 0; index < 3000; index++)
+        if (index % 3) {
+            sprintf(key, "%lu", index);
+            ClassArrayMap._impl_Map.remove(ordered, key);
+        }
+
+    ClassArrayMap._impl_Map.remove(ordered, "missing");
+    ClassArrayMap._impl_Map.set(ordered, "0", (void *) 7);
+    ClassArrayMap._impl_Map.set(ordered, "1", (void *) 2);
+    assert(ClassArrayMap._impl_Map.length(ordered) == 1001);
+
+    for (unsigned long int index = 3; index < 3000; index++) {
+        sprintf(key, "%lu", index);
+        assert(ClassArrayMap._impl_Map.get(ordered, key) == (index % 3 ? NULL : (void *) (index + 1)));
+    }
+
+    ArrayMap *orderedCopy = ClassArrayMap._impl_Map._impl_CCObject.copy(ordered);
+    String *orderedAsString = ClassArrayMap._impl_Map._impl_CCObject.toString(ordered);
+    String *copyAsString = ClassArrayMap._impl_Map._impl_CCObject.toString(orderedCopy);
+
+    assert(!strncmp(orderedAsString->class->getValue(orderedAsString),
+                    "ArrayMap: [ 0:7, 3:4, 6:7, 9:10, ", 33));
+    assert(strstr(orderedAsString->class->getValue(orderedAsString), ", 2997:2998, 1:2 ] (1001);"));
+    assert(orderedAsString->class->equals(orderedAsString, copyAsString));
+
+    // Testing forEachEntry() & Map_forEach()
+    unsigned long int sum = 0;
+    ClassArrayMap._impl_Map.forEachEntry(ordered, &sumUntilNine, &sum);
+    assert(sum == 7 + 4 + 7 + 10);
+
+    unsigned long int visited = 0;
+    Map_forEach(ordered, entryKey, entryValue, {
+        assert(ClassArrayMap._impl_Map.get(ordered, entryKey) == entryValue);
+        assert(visited || !strcmp(entryKey, "0"));
+        visited++;
+    });
+    assert(visited == 1001);
+
+    delete(copyAsString);
+    delete(orderedAsString);
+    delete(orderedCopy);
+    delete(ordered);
+
+    // Testing toString() of a large map
+    ArrayMap *large = CreateArrayMap();
+    for (unsigned long int index = 0; index < 100000; index++) {
+        sprintf(key, "%lu", index);
+        ClassArrayMap._impl_Map.set(large, key, (void *) index);
+    }
+
+    String *largeAsString = ClassArrayMap._impl_Map._impl_CCObject.toString(large);
+    assert(!strncmp(largeAsString->class->getValue(largeAsString), "ArrayMap: [ 0:0, 1:1, ", 22));
+    assert(strstr(largeAsString->class->getValue(largeAsString), ", 99999:99999 ] (100000);"));
+
+    delete(largeAsString);
+    delete(large);
     delete(map);
 
     return 0;
@@ -0,0 +1,137 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/ccomponents.h"
+
+/** Collects the visited values into the array behind the context, stopping after 100 */
+static bool collect(char *key, void *value, void *context) {
+    unsigned long int *collected = (unsigned long int *) context;
+    collected[++collected[0]] = (unsigned long int) value;
+    return collected[0] < 100;
+}
+
+int main(int argc, char **argv) {
+
+    // Testing constructor
+    BTreeMap *map = CreateBTreeMap();
+    
+    assert(ClassBTreeMap._impl_Map.length(map) == 0);
+    assert(!ClassBTreeMap._impl_Map.get(map, "0"));
+    assert(!ClassBTreeMap.firstKey(map) && !ClassBTreeMap.lastKey(map));
+
+    // Testing set() & get()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+    
+    ClassBTreeMap._impl_Map.set(map, "3", testData[3]);
+    ClassBTreeMap._impl_Map.set(map, "1", testData[1]);
+    ClassBTreeMap._impl_Map.set(map, "0", testData[0]);
+    ClassBTreeMap._impl_Map.set(map, "2", testData[2]);
+
+    ClassBTreeMap._impl_Map.set(map, "2", testData[0]);
+
+    assert(ClassBTreeMap._impl_Map.length(map) == 4);
+    assert(ClassBTreeMap._impl_Map.get(map, "2") == ClassBTreeMap._impl_Map.get(map, "0"));
+
+    // Testing remove() & get()
+    ClassBTreeMap._impl_Map.remove(map, "0");
+    ClassBTreeMap._impl_Map.remove(map, "missing");
+
+    assert(ClassBTreeMap._impl_Map.length(map) == 3);
+    assert(!(strcmp(ClassBTreeMap._impl_Map.get(map, "1"), testData[1])) &&
+           !(strcmp(ClassBTreeMap._impl_Map.get(map, "2"), testData[0])) &&
+           !(strcmp(ClassBTreeMap._impl_Map.get(map, "3"), testData[3])) );
+
+    // Testing toString()
+    String *mapAsString = ClassBTreeMap._impl_Map._impl_CCObject.toString(map);
+    delete(mapAsString);
+
+    // Testing copy()
+    BTreeMap *copy = ClassBTreeMap._impl_Map._impl_CCObject.copy(map);
+    assert(!(strcmp(ClassBTreeMap._impl_Map.get(copy, "1"), testData[1])) &&
+           !(strcmp(ClassBTreeMap._impl_Map.get(copy, "2"), testData[0])) &&
+           !(strcmp(ClassBTreeMap._impl_Map.get(copy, "3"), testData[3])) );
+
+    ClassBTreeMap._impl_Map.remove(copy, "1");
+    assert(ClassBTreeMap._impl_Map.get(map, "1") == testData[1]);
+    delete(copy);
+
+    // Testing splits & merges against a larger set of keys
+    BTreeMap *large = CreateBTreeMap();
+    char key[32];
+    for (unsigned long int index = 0; index < 20000; index++) {
+        sprintf(key, "bucket/%05lu", (index * 7919) % 20000);
+        ClassBTreeMap._impl_Map.set(large, key, (void *) ((index * 7919) % 20000 + 1));
+    }
+
+    assert(ClassBTreeMap._impl_Map.length(large) == 20000);
+    assert(!strcmp(ClassBTreeMap.firstKey(large), "bucket/00000"));
+    assert(!strcmp(ClassBTreeMap.lastKey(large), "bucket/19999"));
+
+    for (unsigned long int index = 0; index < 20000; index++)
+        if (index % 5) {
+            sprintf(key, "bucket/%05lu", index);
+            ClassBTreeMap._impl_Map.remove(large, key);
+        }
+
+    assert(ClassBTreeMap._impl_Map.length(large) == 4000);
+    assert(!strcmp(ClassBTreeMap.lastKey(large), "bucket/19995"));
+    for (unsigned long int index = 0; index < 20000; index++) {
+        sprintf(key, "bucket/%05lu", index);
+        assert(ClassBTreeMap._impl_Map.get(large, key) == (index % 5 ? NULL : (void *) (index + 1)));
+    }
+
+    // Testing rangeScan()
+    unsigned long int collected[101] = { 0 };
+    ClassBTreeMap.rangeScan(large, "bucket/00012", "bucket/00031", &collect, collected);
+    assert(collected[0] == 4);
+    assert(collected[1] == 16 && collected[2] == 21 && collected[3] == 26 && collected[4] == 31);
+
+    collected[0] = 0;
+    ClassBTreeMap.rangeScan(large, NULL, NULL, &collect, collected);
+    assert(collected[0] == 100 && collected[100] == 496);
+
+    collected[0] = 0;
+    ClassBTreeMap.rangeScan(large, "bucket/19990", "z", &collect, collected);
+    assert(collected[0] == 2 && collected[2] == 19996);
+
+    BTreeMap *largeCopy = ClassBTreeMap._impl_Map._impl_CCObject.copy(large);
+    for (unsigned long int index = 0; index < 20000; index += 5) {
+        sprintf(key, "bucket/%05lu", index);
+        ClassBTreeMap._impl_Map.remove(large, key);
+    }
+
+    assert(!ClassBTreeMap._impl_Map.length(large) && !ClassBTreeMap.firstKey(large));
+    assert(ClassBTreeMap._impl_Map.length(largeCopy) == 4000);
+
+    collected[0] = 0;
+    ClassBTreeMap.rangeScan(largeCopy, "bucket/19990", NULL, &collect, collected);
+    assert(collected[0] == 2 && collected[1] == 19991);
+
+    // Testing forEachEntry() & Map_forEach()
+    collected[0] = 0;
+    ClassBTreeMap._impl_Map.forEachEntry(largeCopy, &collect, collected);
+    assert(collected[0] == 100 && collected[1] == 1 && collected[100] == 496);
+
+    unsigned long int visited = 0;
+    Map_forEach(largeCopy, entryKey, entryValue, {
+        sprintf(key, "bucket/%05lu", visited * 5);
+        assert(!strcmp(entryKey, key) && entryValue == (void *) (visited * 5 + 1));
+        visited++;
+    });
+    assert(visited == 4000);
+
+    Map_forEach(large, entryKey, entryValue, {
+        assert(false);
+    });
+
+    delete(largeCopy);
+    delete(large);
+    delete(map);
+
+    return 0;
+}
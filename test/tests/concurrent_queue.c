@@ -0,0 +1,128 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../../src/ccomponents.h"
+
+#define THREADS 4
+#define ITEMS 20000
+
+static ConcurrentQueue *shared;
+static unsigned long int sums[THREADS];
+static atomic_bool finished;
+
+static void *produce(void *argument) {
+    unsigned long int thread = (unsigned long int) argument;
+
+    for (unsigned long int index = 1; index <= ITEMS; index++)
+        ClassConcurrentQueue.offer(shared, (void *) (thread * ITEMS + index));
+
+    return NULL;
+}
+
+static void *consume(void *argument) {
+    unsigned long int thread = (unsigned long int) argument;
+
+    for (unsigned long int taken = 0; taken < ITEMS;) {
+        void *value = ClassConcurrentQueue.poll(shared);
+        if (value) {
+            sums[thread] += (unsigned long int) value;
+            taken++;
+        }
+    }
+
+    return NULL;
+}
+
+/** Takes snapshots of the queue until the consumers are done */
+static void *observe(void *argument) {
+
+    while (!atomic_load(&finished)) {
+        delete(ClassConcurrentQueue._impl_CCObject.toString(shared));
+
+        ConcurrentQueue *snapshot = ClassConcurrentQueue._impl_CCObject.copy(shared);
+        while (ClassConcurrentQueue.poll(snapshot))
+            ;
+        delete(snapshot);
+    }
+
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+
+    // Testing constructor
+    ConcurrentQueue *queue = CreateConcurrentQueue();
+    assert(!ClassConcurrentQueue.size(queue));
+    assert(!ClassConcurrentQueue.poll(queue));
+
+    // Testing offer() & poll()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+
+    for (int x = 0; x < 4; x++)
+        assert(ClassConcurrentQueue.offer(queue, testData[x]));
+
+    assert(ClassConcurrentQueue.size(queue) == 4);
+    for (int x = 0; x < 2; x++)
+        assert(ClassConcurrentQueue.poll(queue) == testData[x]);
+
+    assert(ClassConcurrentQueue.size(queue) == 2);
+
+    // Testing toString() & copy()
+    String *queueAsString = ClassConcurrentQueue._impl_CCObject.toString(queue);
+    delete(queueAsString);
+
+    ConcurrentQueue *copy = ClassConcurrentQueue._impl_CCObject.copy(queue);
+    assert(ClassConcurrentQueue.size(copy) == 2);
+    assert(ClassConcurrentQueue.poll(copy) == testData[2]);
+    assert(ClassConcurrentQueue.poll(copy) == testData[3]);
+    assert(!ClassConcurrentQueue.poll(copy));
+    assert(ClassConcurrentQueue.size(queue) == 2);
+    delete(copy);
+
+    assert(ClassConcurrentQueue.poll(queue) == testData[2]);
+    assert(ClassConcurrentQueue.poll(queue) == testData[3]);
+
+    ConcurrentQueue *numbers = CreateConcurrentQueue();
+    for (unsigned long int x = 1; x <= 3; x++)
+        ClassConcurrentQueue.offer(numbers, (void *) x);
+
+    queueAsString = ClassConcurrentQueue._impl_CCObject.toString(numbers);
+    assert(queueAsString->class->equalsChr(queueAsString, "ConcurrentQueue: [ 1, 2, 3 ] (3);"));
+    delete(queueAsString);
+    delete(numbers);
+
+    // Testing concurrent producers & consumers while another thread takes snapshots
+    shared = queue;
+    pthread_t producers[THREADS], consumers[THREADS], observer;
+    pthread_create(&observer, NULL, &observe, NULL);
+    for (unsigned long int thread = 0; thread < THREADS; thread++) {
+        pthread_create(&producers[thread], NULL, &produce, (void *) thread);
+        pthread_create(&consumers[thread], NULL, &consume, (void *) thread);
+    }
+
+    for (int thread = 0; thread < THREADS; thread++) {
+        pthread_join(producers[thread], NULL);
+        pthread_join(consumers[thread], NULL);
+    }
+
+    atomic_store(&finished, true);
+    pthread_join(observer, NULL);
+
+    unsigned long int total = 0, expected = 0;
+    for (unsigned long int thread = 0; thread < THREADS; thread++) {
+        total += sums[thread];
+        expected += thread * ITEMS * ITEMS + ITEMS * (ITEMS + 1) / 2;
+    }
+
+    assert(total == expected);
+    assert(!ClassConcurrentQueue.poll(queue));
+    assert(!ClassConcurrentQueue.size(queue));
+
+    delete(queue);
+
+    return 0;
+}
@@ -0,0 +1,110 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/ccomponents.h"
+
+/** Counts the visited entries into the context */
+static bool countEntries(char *key, void *value, void *context) {
+    ++*(unsigned long int *) context;
+    return true;
+}
+
+int main(int argc, char **argv) {
+
+    // Testing ArrayMap's freeze()
+    ArrayMap *source = CreateArrayMap();
+
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+    
+    ClassArrayMap._impl_Map.set(source, "0", testData[0]);
+    ClassArrayMap._impl_Map.set(source, "1", testData[1]);
+    ClassArrayMap._impl_Map.set(source, "2", testData[2]);
+    ClassArrayMap._impl_Map.set(source, "3", testData[3]);
+    ClassArrayMap._impl_Map.remove(source, "0");
+
+    FrozenMap *map = ClassArrayMap.freeze(source);
+    delete(source);
+
+    assert(ClassFrozenMap._impl_Map.length(map) == 3);
+    assert(ClassFrozenMap._impl_Map.get(map, "1") == testData[1] &&
+           ClassFrozenMap._impl_Map.get(map, "2") == testData[2] &&
+           ClassFrozenMap._impl_Map.get(map, "3") == testData[3] );
+    assert(!ClassFrozenMap._impl_Map.get(map, "0"));
+    assert(!ClassFrozenMap._impl_Map.get(map, "10"));
+
+    // Testing that set() & remove() do nothing
+    ClassFrozenMap._impl_Map.set(map, "1", testData[0]);
+    ClassFrozenMap._impl_Map.set(map, "4", testData[0]);
+    ClassFrozenMap._impl_Map.remove(map, "2");
+
+    assert(ClassFrozenMap._impl_Map.length(map) == 3);
+    assert(ClassFrozenMap._impl_Map.get(map, "1") == testData[1]);
+    assert(ClassFrozenMap._impl_Map.get(map, "2") == testData[2]);
+    assert(!ClassFrozenMap._impl_Map.get(map, "4"));
+
+    // Testing toString() & copy()
+    String *mapAsString = ClassFrozenMap._impl_Map._impl_CCObject.toString(map);
+    delete(mapAsString);
+
+    FrozenMap *copy = ClassFrozenMap._impl_Map._impl_CCObject.copy(map);
+    delete(map);
+    assert(ClassFrozenMap._impl_Map.length(copy) == 3);
+    assert(ClassFrozenMap._impl_Map.get(copy, "3") == testData[3]);
+    delete(copy);
+
+    // Testing constructor with empty input & duplicate keys
+    FrozenMap *empty = CreateFrozenMap(NULL, NULL, 0);
+    assert(!ClassFrozenMap._impl_Map.length(empty));
+    assert(!ClassFrozenMap._impl_Map.get(empty, ""));
+    Map_forEach(empty, entryKey, entryValue, {
+        assert(false);
+    });
+    delete(empty);
+
+    char *keys[5] = { "a", "b", "a", "", "b" };
+    void *values[5] = { (void *) 1, (void *) 2, (void *) 3, (void *) 4, (void *) 5 };
+    FrozenMap *duplicates = CreateFrozenMap(keys, values, 5);
+
+    assert(ClassFrozenMap._impl_Map.length(duplicates) == 3);
+    assert(ClassFrozenMap._impl_Map.get(duplicates, "a") == (void *) 3 &&
+           ClassFrozenMap._impl_Map.get(duplicates, "b") == (void *) 5 &&
+           ClassFrozenMap._impl_Map.get(duplicates, "") == (void *) 4 );
+    delete(duplicates);
+
+    // Testing a larger set of keys
+    ArrayMap *large = CreateArrayMap();
+    char key[32];
+    for (unsigned long int index = 0; index < 50000; index++) {
+        sprintf(key, "route/%lu", index);
+        ClassArrayMap._impl_Map.set(large, key, (void *) (index + 1));
+    }
+
+    FrozenMap *frozen = ClassArrayMap.freeze(large);
+    assert(ClassFrozenMap._impl_Map.length(frozen) == 50000);
+    for (unsigned long int index = 0; index < 100000; index++) {
+        sprintf(key, "route/%lu", index);
+        assert(ClassFrozenMap._impl_Map.get(frozen, key) == (index < 50000 ? (void *) (index + 1) : NULL));
+    }
+
+    // Testing Map_forEach() & forEachEntry()
+    unsigned long int visited = 0;
+    Map_forEach(frozen, entryKey, entryValue, {
+        assert(ClassArrayMap._impl_Map.get(large, entryKey) == entryValue);
+        visited++;
+    });
+    assert(visited == 50000);
+
+    visited = 0;
+    ClassFrozenMap._impl_Map.forEachEntry(frozen, &countEntries, &visited);
+    assert(visited == 50000);
+
+    delete(frozen);
+    delete(large);
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/ccomponents.h"
+
+/** Counts the visited entries with odd values into the context */
+static bool countOdd(char *key, void *value, void *context) {
+    *(unsigned long int *) context += (unsigned long int) value % 2;
+    return true;
+}
+
+int main(int argc, char **argv) {
+
+    // Testing constructor
+    HashMap *map = CreateHashMap();
+    
+    assert(ClassHashMap._impl_Map.length(map) == 0);
+    assert(!ClassHashMap._impl_Map.get(map, "0"));
+
+    // Testing set() & get()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+    
+    ClassHashMap._impl_Map.set(map, "0", testData[0]);
+    ClassHashMap._impl_Map.set(map, "1", testData[1]);
+    ClassHashMap._impl_Map.set(map, "2", testData[2]);
+    ClassHashMap._impl_Map.set(map, "3", testData[3]);
+
+    ClassHashMap._impl_Map.set(map, "2", testData[0]);
+
+    assert(ClassHashMap._impl_Map.length(map) == 4);
+    assert(ClassHashMap._impl_Map.get(map, "2") == ClassHashMap._impl_Map.get(map, "0"));
+
+    // Testing remove() & get()
+    ClassHashMap._impl_Map.remove(map, "0");
+    ClassHashMap._impl_Map.remove(map, "missing");
+
+    assert(ClassHashMap._impl_Map.length(map) == 3);
+    assert(!ClassHashMap._impl_Map.get(map, "0"));
+    assert(!(strcmp(ClassHashMap._impl_Map.get(map, "1"), testData[1])) &&
+           !(strcmp(ClassHashMap._impl_Map.get(map, "2"), testData[0])) &&
+           !(strcmp(ClassHashMap._impl_Map.get(map, "3"), testData[3])) );
+
+    // Testing toString()
+    String *mapAsString = ClassHashMap._impl_Map._impl_CCObject.toString(map);
+    delete(mapAsString);
+
+    // Testing copy()
+    HashMap *copy = ClassHashMap._impl_Map._impl_CCObject.copy(map);
+    assert(!(strcmp(ClassHashMap._impl_Map.get(copy, "1"), testData[1])) &&
+           !(strcmp(ClassHashMap._impl_Map.get(copy, "2"), testData[0])) &&
+           !(strcmp(ClassHashMap._impl_Map.get(copy, "3"), testData[3])) );
+
+    ClassHashMap._impl_Map.set(copy, "4", testData[2]);
+    assert(!ClassHashMap._impl_Map.get(map, "4"));
+    delete(copy);
+
+    // Testing growth, removal churn & reserve()
+    HashMap *large = CreateHashMap();
+    ClassHashMap.reserve(large, 1000);
+
+    char key[32];
+    for (unsigned long int round = 0; round < 4; round++) {
+        for (unsigned long int index = 0; index < 20000; index++) {
+            sprintf(key, "key-%lu", index);
+            ClassHashMap._impl_Map.set(large, key, (void *) (index + round));
+        }
+
+        assert(ClassHashMap._impl_Map.length(large) == 20000);
+        for (unsigned long int index = 0; index < 20000; index++) {
+            sprintf(key, "key-%lu", index);
+            assert(ClassHashMap._impl_Map.get(large, key) == (void *) (index + round));
+        }
+
+        for (unsigned long int index = round % 2; index < 20000; index += 2) {
+            sprintf(key, "key-%lu", index);
+            ClassHashMap._impl_Map.remove(large, key);
+        }
+
+        assert(ClassHashMap._impl_Map.length(large) == 10000);
+        for (unsigned long int index = 0; index < 20000; index++) {
+            sprintf(key, "key-%lu", index);
+            assert((ClassHashMap._impl_Map.get(large, key) != NULL) == (index % 2 != round % 2));
+        }
+    }
+
+    // Testing forEachEntry() & Map_forEach()
+    unsigned long int visited = 0;
+    ClassHashMap._impl_Map.forEachEntry(large, &countOdd, &visited);
+    assert(visited == 10000);
+
+    visited = 0;
+    Map_forEach(large, entryKey, entryValue, {
+        assert(ClassHashMap._impl_Map.get(large, entryKey) == entryValue);
+        visited++;
+    });
+    assert(visited == 10000);
+
+    delete(large);
+    delete(map);
+
+    return 0;
+}
@@ -1,7 +1,31 @@
 #include <assert.h>
+#include <pthread.h>
 
 #include "../../src/ccomponents.h"
 
+/** Orders by the upper bits only, so that equal keys show whether the sort is stable */
+static int compareKeys(void *a, void *b) {
+    unsigned long int left = (unsigned long int) a >> 16, right = (unsigned long int) b >> 16;
+    return (left > right) - (left < right);
+}
+
+/** Churns through the entries of the list, then deletes it */
+static void *churn(void *argument) {
+    LinkedList *list = (LinkedList *) argument;
+
+    for (unsigned long int round = 0; round < 20000; round++) {
+        ClassLinkedList.removeFirst(list);
+        ClassLinkedList._impl_List.add(list, (void *) round);
+        if (round % 7 == 0)
+            ClassLinkedList.addFirst(list, (void *) round);
+    }
+
+    assert(ClassLinkedList._impl_List.length(list) == 500 + 20000 / 7 + 1);
+    delete(list);
+
+    return NULL;
+}
+
 int main(int argc, char **argv) {
     
     // Testing constructor
@@ -42,6 +66,139 @@ int main(int argc, char **argv) {
         ._impl_CCObject.toString(list);
     delete(listAsString);
 
+    // Testing iterator() & List_forEachRemove()
+    ListIterator iterator = ClassLinkedList._impl_List.iterator(list);
+    for (unsigned long int index = 0; index < ClassLinkedList._impl_List.length(list); index++) {
+        assert(iterator.hasNext(&iterator));
+        assert(iterator.next(&iterator) == ClassLinkedList._impl_List.get(list, index));
+    }
+    assert(!iterator.hasNext(&iterator));
+
+    // Every round adds onto entries freed in the round before, then removes the
+    // older values, the odd new ones and with them the last entry
+    LinkedList *filtered = CreateLinkedList();
+    for (unsigned long int round = 0; round < 4; round++) {
+        for (unsigned long int index = 0; index < 100; index++)
+            ClassLinkedList._impl_List.add(filtered, (void *) (round * 100 + index));
+
+        List_forEach(filtered, item, {
+            if ((unsigned long int) item < round * 100 || (unsigned long int) item % 2)
+                List_forEachRemove(item);
+        });
+
+        unsigned long int expected = round * 100;
+        List_forEach(filtered, item, {
+            assert(item == (void *) expected);
+            expected += 2;
+        });
+
+        assert(ClassLinkedList._impl_List.length(filtered) == 50);
+        assert(ClassLinkedList.getFirst(filtered) == (void *) (round * 100) &&
+               ClassLinkedList.getLast(filtered) == (void *) (round * 100 + 98));
+    }
+
+    delete(filtered);
+
+    // Testing entry reuse on a busy queue
+    LinkedList *queue = CreateLinkedList();
+    for (unsigned long round = 0; round < 3; round++) {
+        for (unsigned long index = 0; index < 5000; index++)
+            ClassLinkedList._impl_List.add(queue, (void *) index);
+        for (unsigned long index = 0; index < 5000; index++) {
+            assert(ClassLinkedList.getFirst(queue) == (void *) index);
+            ClassLinkedList.removeFirst(queue);
+        }
+    }
+
+    assert(!ClassLinkedList._impl_List.length(queue));
+
+    // Testing near-sequential indexed access
+    for (unsigned long index = 0; index < 1000; index++)
+        ClassLinkedList._impl_List.add(queue, (void *) index);
+
+    for (unsigned long index = 400; index < 600; index++) {
+        assert(ClassLinkedList._impl_List.get(queue, index) == (void *) index);
+        ClassLinkedList._impl_List.set(queue, index + 1, (void *) (index + 1));
+        assert(ClassLinkedList._impl_List.get(queue, index - 3) == (void *) (index - 3));
+    }
+
+    ClassLinkedList._impl_List.remove(queue, 500);
+    assert(ClassLinkedList._impl_List.get(queue, 500) == (void *) 501);
+    ClassLinkedList.addFirst(queue, NULL);
+    assert(ClassLinkedList._impl_List.get(queue, 500) == (void *) 499);
+    assert(ClassLinkedList._impl_List.get(queue, 502) == (void *) 502);
+
+    while (ClassLinkedList._impl_List.length(queue))
+        ClassLinkedList.removeLast(queue);
+    ClassLinkedList.addFirst(queue, testData[0]);
+    ClassLinkedList._impl_List.add(queue, testData[1]);
+    assert(ClassLinkedList.getFirst(queue) == testData[0] &&
+           ClassLinkedList.getLast(queue) == testData[1]);
+
+    ClassLinkedList.removeFirst(queue);
+    ClassLinkedList.removeFirst(queue);
+
+    // Testing splice() & splitAt() & moveRange()
+    LinkedList *other = CreateLinkedList();
+    for (unsigned long index = 0; index < 10; index++) {
+        ClassLinkedList._impl_List.add(queue, (void *) index);
+        ClassLinkedList._impl_List.add(other, (void *) (index + 10));
+    }
+
+    ClassLinkedList.splice(queue, other);
+    assert(ClassLinkedList._impl_List.length(queue) == 20);
+    assert(!ClassLinkedList._impl_List.length(other));
+    assert(!ClassLinkedList.getFirst(other));
+    for (unsigned long index = 0; index < 20; index++)
+        assert(ClassLinkedList._impl_List.get(queue, index) == (void *) index);
+
+    LinkedList *tail = ClassLinkedList.splitAt(queue, 15);
+    assert(ClassLinkedList._impl_List.length(queue) == 15);
+    assert(ClassLinkedList._impl_List.length(tail) == 5);
+    assert(ClassLinkedList.getLast(queue) == (void *) 14);
+    assert(ClassLinkedList.getFirst(tail) == (void *) 15);
+
+    ClassLinkedList.moveRange(queue, 2, 5, other);
+    assert(ClassLinkedList._impl_List.length(queue) == 12);
+    assert(ClassLinkedList._impl_List.get(queue, 2) == (void *) 5);
+    assert(ClassLinkedList._impl_List.length(other) == 3);
+    assert(ClassLinkedList.getFirst(other) == (void *) 2 &&
+           ClassLinkedList.getLast(other) == (void *) 4);
+
+    delete(queue);
+    ClassLinkedList.addFirst(tail, (void *) 1);
+    ClassLinkedList.splice(other, tail);
+    assert(ClassLinkedList._impl_List.length(other) == 9);
+    assert(ClassLinkedList._impl_List.get(other, 3) == (void *) 1 &&
+           ClassLinkedList.getLast(other) == (void *) 19);
+
+    delete(tail);
+
+    // Testing lists that exchanged entries modified & deleted from different threads
+    LinkedList *left = CreateLinkedList(), *right = CreateLinkedList();
+    for (unsigned long index = 0; index < 500; index++) {
+        ClassLinkedList._impl_List.add(left, (void *) index);
+        ClassLinkedList._impl_List.add(right, (void *) (index + 500));
+    }
+
+    ClassLinkedList.splice(left, right);
+    ClassLinkedList.moveRange(left, 100, 600, right);
+    ClassLinkedList.removeFirst(left);
+    ClassLinkedList.removeFirst(right);
+    ClassLinkedList._impl_List.add(left, (void *) 1000);
+    ClassLinkedList._impl_List.add(right, (void *) 1001);
+
+    assert(ClassLinkedList._impl_List.length(left) == 500 &&
+           ClassLinkedList._impl_List.length(right) == 500);
+    assert(ClassLinkedList.getFirst(left) == (void *) 1 && ClassLinkedList.getLast(left) == (void *) 1000);
+    assert(ClassLinkedList.getFirst(right) == (void *) 101 && ClassLinkedList.getLast(right) == (void *) 1001);
+
+    pthread_t threads[2];
+    pthread_create(&threads[0], NULL, &churn, left);
+    pthread_create(&threads[1], NULL, &churn, right);
+    pthread_join(threads[0], NULL);
+    pthread_join(threads[1], NULL);
+
     // Testing copy()
     LinkedList *copy = ClassLinkedList._impl_List._impl_CCObject.copy(list);
     assert(ClassLinkedList._impl_List.length(copy) == 3);
@@ -50,6 +207,52 @@ int main(int argc, char **argv) {
         assert(ClassLinkedList._impl_List.get(copy, index) == 
                ClassLinkedList._impl_List.get(list, index));
 
+    ClassLinkedList._impl_List.set(copy, 0, testData[3]);
+    assert(ClassLinkedList._impl_List.get(list, 0) == testData[1]);
+
+    ClassLinkedList.removeLast(copy);
+    ClassLinkedList._impl_List.add(copy, testData[2]);
+    assert(ClassLinkedList.getLast(copy) == testData[2]);
+    assert(ClassLinkedList.getLast(list) == testData[3]);
+    assert(ClassLinkedList._impl_List.length(copy) == 3);
+
+    LinkedList *otherCopy = ClassLinkedList._impl_List._impl_CCObject.copy(other);
+    delete(other);
+    assert(ClassLinkedList._impl_List.length(otherCopy) == 9);
+    assert(ClassLinkedList.getFirst(otherCopy) == (void *) 2 &&
+           ClassLinkedList.getLast(otherCopy) == (void *) 19);
+    delete(otherCopy);
+
+    // Testing sort()
+    LinkedList *events = CreateLinkedList();
+    ClassLinkedList.sort(events, &compareKeys);
+    assert(!ClassLinkedList.getFirst(events));
+
+    unsigned long int seed = 7;
+    for (unsigned long int index = 0; index < 10000; index++) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        ClassLinkedList._impl_List.add(events, (void *) ((seed >> 54) << 16 | index));
+    }
+
+    ClassLinkedList.sort(events, &compareKeys);
+    assert(ClassLinkedList._impl_List.length(events) == 10000);
+
+    unsigned long int previous = 0;
+    List_forEach(events, item, {
+        unsigned long int current = (unsigned long int) item;
+        assert(compareKeys((void *) previous, item) < 0 ||
+               (compareKeys((void *) previous, item) == 0 && (previous & 0xFFFF) < (current & 0xFFFF)));
+        previous = current;
+    });
+
+    assert(ClassLinkedList.getLast(events) == (void *) previous);
+    for (unsigned long int index = 10000; index > 9990; index--) {
+        assert(ClassLinkedList._impl_List.get(events, index - 1) == (void *) previous);
+        previous = (unsigned long int) ClassLinkedList._impl_List.get(events, index - 2);
+    }
+
+    delete(events);
+
     // Testing addFirst
     ClassLinkedList.addFirst(list, testData[2]);
     assert(ClassLinkedList._impl_List.length(list) == 4);
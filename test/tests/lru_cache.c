@@ -0,0 +1,132 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/ccomponents.h"
+
+/** Remembers the last evicted entry and counts the evictions in the array behind the context */
+static void recordEviction(char *key, void *value, void *context) {
+    unsigned long int *evictions = (unsigned long int *) context;
+    evictions[0]++;
+    evictions[1] = (unsigned long int) value;
+    evictions[2] = (unsigned long int) strtoul(key, NULL, 10);
+}
+
+/** Puts "x" into the cache the context points to whenever "a" is evicted from it */
+static void reinsertOnEviction(char *key, void *value, void *context) {
+    if (!strcmp(key, "a"))
+        ClassLRUCache._impl_Map.set(*(LRUCache **) context, "x", value);
+}
+
+int main(int argc, char **argv) {
+
+    // Testing constructor
+    unsigned long int evictions[3] = { 0 };
+    LRUCache *cache = CreateLRUCache(3, &recordEviction, evictions);
+
+    assert(ClassLRUCache._impl_Map.length(cache) == 0);
+    assert(ClassLRUCache.capacity(cache) == 3);
+
+    // Testing set() & get() & eviction
+    ClassLRUCache._impl_Map.set(cache, "1", (void *) 10);
+    ClassLRUCache._impl_Map.set(cache, "2", (void *) 20);
+    ClassLRUCache._impl_Map.set(cache, "3", (void *) 30);
+    assert(ClassLRUCache._impl_Map.length(cache) == 3);
+    assert(!evictions[0]);
+
+    assert(ClassLRUCache._impl_Map.get(cache, "1") == (void *) 10);
+    ClassLRUCache._impl_Map.set(cache, "4", (void *) 40);
+
+    assert(ClassLRUCache._impl_Map.length(cache) == 3);
+    assert(evictions[0] == 1 && evictions[1] == 20 && evictions[2] == 2);
+    assert(!ClassLRUCache._impl_Map.get(cache, "2"));
+
+    ClassLRUCache._impl_Map.set(cache, "3", (void *) 31);
+    ClassLRUCache._impl_Map.set(cache, "5", (void *) 50);
+    assert(evictions[0] == 2 && evictions[1] == 10 && evictions[2] == 1);
+
+    // Testing hits() & misses() & peek()
+    assert(ClassLRUCache.hits(cache) == 1 && ClassLRUCache.misses(cache) == 1);
+    assert(ClassLRUCache.peek(cache, "4") == (void *) 40);
+    assert(!ClassLRUCache.peek(cache, "1"));
+    assert(ClassLRUCache.hits(cache) == 1 && ClassLRUCache.misses(cache) == 1);
+
+    ClassLRUCache._impl_Map.set(cache, "6", (void *) 60);
+    assert(evictions[2] == 4);
+
+    // Testing toString() & Map_forEach()
+    String *cacheAsString = ClassLRUCache._impl_Map._impl_CCObject.toString(cache);
+    assert(cacheAsString->class->equalsChr(cacheAsString, "LRUCache: [ 6:60, 5:50, 3:31 ] (3);"));
+    delete(cacheAsString);
+
+    unsigned long int previous = 100;
+    Map_forEach(cache, entryKey, entryValue, {
+        assert((unsigned long int) entryValue < previous);
+        previous = (unsigned long int) entryValue;
+    });
+    assert(previous == 31);
+
+    // Testing remove() & copy()
+    ClassLRUCache._impl_Map.remove(cache, "5");
+    ClassLRUCache._impl_Map.remove(cache, "missing");
+    assert(ClassLRUCache._impl_Map.length(cache) == 2);
+    assert(evictions[0] == 3);
+
+    LRUCache *copy = ClassLRUCache._impl_Map._impl_CCObject.copy(cache);
+    ClassLRUCache._impl_Map.set(copy, "7", (void *) 70);
+    ClassLRUCache._impl_Map.set(copy, "8", (void *) 80);
+    assert(evictions[0] == 4 && evictions[2] == 3);
+    assert(ClassLRUCache._impl_Map.get(cache, "3") == (void *) 31);
+    assert(ClassLRUCache.hits(copy) == 1 && ClassLRUCache.hits(cache) == 2);
+    delete(copy);
+
+    // Testing a cache without capacity
+    LRUCache *empty = CreateLRUCache(0, &recordEviction, evictions);
+    ClassLRUCache._impl_Map.set(empty, "9", (void *) 90);
+    assert(!ClassLRUCache._impl_Map.length(empty));
+    assert(evictions[0] == 5 && evictions[1] == 90 && evictions[2] == 9);
+    delete(empty);
+
+    // Testing an eviction callback that uses the cache
+    LRUCache *reentered;
+    reentered = CreateLRUCache(2, &reinsertOnEviction, &reentered);
+
+    ClassLRUCache._impl_Map.set(reentered, "a", (void *) 1);
+    ClassLRUCache._impl_Map.set(reentered, "b", (void *) 2);
+    ClassLRUCache._impl_Map.set(reentered, "d", (void *) 4);
+
+    assert(ClassLRUCache._impl_Map.length(reentered) == 2);
+    cacheAsString = ClassLRUCache._impl_Map._impl_CCObject.toString(reentered);
+    assert(cacheAsString->class->equalsChr(cacheAsString, "LRUCache: [ x:1, d:4 ] (2);"));
+    delete(cacheAsString);
+    delete(reentered);
+
+    // Testing a larger working set
+    LRUCache *large = CreateLRUCache(1000, NULL, NULL);
+    char key[32];
+    for (unsigned long int index = 0; index < 100000; index++) {
+        sprintf(key, "page/%lu", index % 1500);
+        if (!ClassLRUCache._impl_Map.get(large, key))
+            ClassLRUCache._impl_Map.set(large, key, (void *) (index + 1));
+    }
+
+    assert(ClassLRUCache._impl_Map.length(large) == 1000);
+    assert(ClassLRUCache.hits(large) + ClassLRUCache.misses(large) == 100000);
+
+    // Cycling through more keys than fit evicts every key before it comes back
+    assert(!ClassLRUCache.hits(large));
+
+    for (unsigned long int index = 0; index < 100000; index++) {
+        sprintf(key, "page/%lu", index % 500);
+        if (!ClassLRUCache._impl_Map.get(large, key))
+            ClassLRUCache._impl_Map.set(large, key, (void *) (index + 1));
+    }
+
+    assert(ClassLRUCache.misses(large) == 100000 && ClassLRUCache.hits(large) == 100000);
+
+    delete(large);
+    delete(cache);
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include <assert.h>
+
+#include "../../src/ccomponents.h"
+
+static int compareNumbers(void *a, void *b) {
+    unsigned long int left = (unsigned long int) a, right = (unsigned long int) b;
+    return (left > right) - (left < right);
+}
+
+int main(int argc, char **argv) {
+    
+    // Testing constructor
+    SkipList *list = CreateSkipList();
+    assert(!ClassSkipList._impl_List.length(list));
+
+    // Testing push()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+
+    for (int x = 0; x < 4; x++)
+        ClassSkipList._impl_List.add(list, testData[x]);
+
+    assert(ClassSkipList._impl_List.length(list) == 4);
+
+    for (int x = 0; x < 4; x++) 
+        assert(ClassSkipList._impl_List.get(list, x) == testData[x]);
+
+    // Testing set() & get()
+    ClassSkipList._impl_List.set(list, 2, testData[0]);
+
+    assert(ClassSkipList._impl_List.length(list) == 4);
+    assert(ClassSkipList._impl_List.get(list, 2) == ClassSkipList
+        ._impl_List.get(list, 0));
+
+    // Testing remove() & get()
+    ClassSkipList._impl_List.remove(list, 0);
+
+    assert(ClassSkipList._impl_List.length(list) == 3);
+    assert(ClassSkipList._impl_List.get(list, 0) == testData[1] &&
+           ClassSkipList._impl_List.get(list, 1) == testData[0] &&
+           ClassSkipList._impl_List.get(list, 2) == testData[3] );
+
+    // Testing toString()
+    String *listAsString = ClassSkipList._impl_List
+        ._impl_CCObject.toString(list);
+    delete(listAsString);
+
+    // Testing insertAt()
+    ClassSkipList.insertAt(list, 0, testData[2]);
+    ClassSkipList.insertAt(list, 4, testData[2]);
+    ClassSkipList.insertAt(list, 2, testData[3]);
+    assert(ClassSkipList._impl_List.length(list) == 6);
+    assert(ClassSkipList._impl_List.get(list, 0) == testData[2] &&
+           ClassSkipList._impl_List.get(list, 1) == testData[1] &&
+           ClassSkipList._impl_List.get(list, 2) == testData[3] &&
+           ClassSkipList._impl_List.get(list, 3) == testData[0] &&
+           ClassSkipList._impl_List.get(list, 4) == testData[3] &&
+           ClassSkipList._impl_List.get(list, 5) == testData[2] );
+
+    // Testing copy()
+    SkipList *copy = ClassSkipList._impl_List._impl_CCObject.copy(list);
+    assert(ClassSkipList._impl_List.length(copy) == 6);
+
+    for (int index = 0; index < 6; index++)
+        assert(ClassSkipList._impl_List.get(copy, index) ==
+               ClassSkipList._impl_List.get(list, index));
+
+    ClassSkipList._impl_List.remove(copy, 5);
+    assert(ClassSkipList._impl_List.length(list) == 6);
+    delete(copy);
+
+    // Testing insertSorted() & lowerBound()
+    SkipList *sorted = CreateSkipList();
+    unsigned long int seed = 3;
+    for (unsigned long int index = 0; index < 5000; index++) {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        unsigned long int value = (seed >> 33) % 1000 * 2 + 2;
+
+        unsigned long int position = ClassSkipList.insertSorted(sorted, (void *) value, &compareNumbers);
+        assert(ClassSkipList._impl_List.get(sorted, position) == (void *) value);
+    }
+
+    unsigned long int previous = 0;
+    List_forEach(sorted, item, {
+        assert(previous <= (unsigned long int) item);
+        previous = (unsigned long int) item;
+    });
+
+    for (unsigned long int value = 1; value < 2004; value++) {
+        unsigned long int bound = ClassSkipList.lowerBound(sorted, (void *) value, &compareNumbers);
+        assert(bound == 5000 || (unsigned long int) ClassSkipList._impl_List.get(sorted, bound) >= value);
+        assert(!bound || (unsigned long int) ClassSkipList._impl_List.get(sorted, bound - 1) < value);
+    }
+
+    // Testing iterator() & remove() by index on a large list
+    List_forEach(sorted, item, {
+        if ((unsigned long int) item % 4)
+            List_forEachRemove(item);
+    });
+
+    List_forEach(sorted, item, {
+        assert(!((unsigned long int) item % 4));
+    });
+
+    while (ClassSkipList._impl_List.length(sorted) > 10)
+        ClassSkipList._impl_List.remove(sorted, ClassSkipList._impl_List.length(sorted) / 3);
+    ClassSkipList.insertAt(sorted, 10, NULL);
+    assert(!ClassSkipList._impl_List.get(sorted, 10));
+
+    delete(sorted);
+    delete(list);
+
+    return 0;
+}
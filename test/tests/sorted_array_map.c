@@ -0,0 +1,119 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../../src/ccomponents.h"
+
+/** Counts the visited entries into the context, stopping after ten */
+static bool countFirstTen(char *key, void *value, void *context) {
+    return ++*(unsigned long int *) context < 10;
+}
+
+int main(int argc, char **argv) {
+
+    // Testing constructor
+    SortedArrayMap *map = CreateSortedArrayMap();
+    
+    assert(ClassSortedArrayMap._impl_Map.length(map) == 0);
+    assert(!ClassSortedArrayMap._impl_Map.get(map, "0"));
+    assert(!ClassSortedArrayMap.floorKey(map, "0") && !ClassSortedArrayMap.ceilingKey(map, "0"));
+
+    // Testing set() & get()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+    
+    ClassSortedArrayMap._impl_Map.set(map, "3", testData[3]);
+    ClassSortedArrayMap._impl_Map.set(map, "1", testData[1]);
+    ClassSortedArrayMap._impl_Map.set(map, "0", testData[0]);
+    ClassSortedArrayMap._impl_Map.set(map, "2", testData[2]);
+
+    ClassSortedArrayMap._impl_Map.set(map, "2", testData[0]);
+
+    assert(ClassSortedArrayMap._impl_Map.length(map) == 4);
+    assert(ClassSortedArrayMap._impl_Map.get(map, "2") == ClassSortedArrayMap._impl_Map.get(map, "0"));
+
+    // Testing remove() & get()
+    ClassSortedArrayMap._impl_Map.remove(map, "0");
+    ClassSortedArrayMap._impl_Map.remove(map, "missing");
+
+    assert(ClassSortedArrayMap._impl_Map.length(map) == 3);
+    assert(!(strcmp(ClassSortedArrayMap._impl_Map.get(map, "1"), testData[1])) &&
+           !(strcmp(ClassSortedArrayMap._impl_Map.get(map, "2"), testData[0])) &&
+           !(strcmp(ClassSortedArrayMap._impl_Map.get(map, "3"), testData[3])) );
+
+    // Testing toString()
+    String *mapAsString = ClassSortedArrayMap._impl_Map._impl_CCObject.toString(map);
+    delete(mapAsString);
+
+    // Testing copy()
+    SortedArrayMap *copy = ClassSortedArrayMap._impl_Map._impl_CCObject.copy(map);
+    assert(!(strcmp(ClassSortedArrayMap._impl_Map.get(copy, "1"), testData[1])) &&
+           !(strcmp(ClassSortedArrayMap._impl_Map.get(copy, "2"), testData[0])) &&
+           !(strcmp(ClassSortedArrayMap._impl_Map.get(copy, "3"), testData[3])) );
+
+    ClassSortedArrayMap._impl_Map.remove(copy, "1");
+    assert(ClassSortedArrayMap._impl_Map.get(map, "1") == testData[1]);
+    delete(copy);
+
+    // Testing buildFrom() & keyAt() & valueAt()
+    char *keys[6] = { "pear", "apple", "user-id-0010", "user-id-0002", "apple", "" };
+    void *values[6] = { (void *) 1, (void *) 2, (void *) 3, (void *) 4, (void *) 5, (void *) 6 };
+    ClassSortedArrayMap.buildFrom(map, keys, values, 6);
+
+    assert(ClassSortedArrayMap._impl_Map.length(map) == 5);
+    assert(!strcmp(ClassSortedArrayMap.keyAt(map, 0), "") &&
+           !strcmp(ClassSortedArrayMap.keyAt(map, 1), "apple") &&
+           !strcmp(ClassSortedArrayMap.keyAt(map, 2), "pear") &&
+           !strcmp(ClassSortedArrayMap.keyAt(map, 3), "user-id-0002") &&
+           !strcmp(ClassSortedArrayMap.keyAt(map, 4), "user-id-0010"));
+    assert(ClassSortedArrayMap.valueAt(map, 1) == (void *) 5);
+    assert(ClassSortedArrayMap._impl_Map.get(map, "user-id-0010") == (void *) 3);
+    assert(!ClassSortedArrayMap._impl_Map.get(map, "user-id-0003"));
+
+    // Testing floorKey() & ceilingKey()
+    assert(!strcmp(ClassSortedArrayMap.floorKey(map, "user-id-0005"), "user-id-0002"));
+    assert(!strcmp(ClassSortedArrayMap.ceilingKey(map, "user-id-0005"), "user-id-0010"));
+    assert(!strcmp(ClassSortedArrayMap.floorKey(map, "pear"), "pear"));
+    assert(!strcmp(ClassSortedArrayMap.ceilingKey(map, "apples"), "pear"));
+    assert(!strcmp(ClassSortedArrayMap.floorKey(map, "a"), ""));
+    assert(!ClassSortedArrayMap.ceilingKey(map, "z"));
+
+    // Testing ordering against a larger set of keys
+    SortedArrayMap *large = CreateSortedArrayMap();
+    char key[32];
+    for (unsigned long int index = 0; index < 4000; index += 2) {
+        sprintf(key, "key/%lu", (index * 7919) % 4000);
+        ClassSortedArrayMap._impl_Map.set(large, key, (void *) (index + 1));
+    }
+
+    for (unsigned long int index = 1; index < 2000; index++)
+        assert(strcmp(ClassSortedArrayMap.keyAt(large, index - 1), ClassSortedArrayMap.keyAt(large, index)) < 0);
+
+    for (unsigned long int index = 0; index < 4000; index++) {
+        sprintf(key, "key/%lu", (index * 7919) % 4000);
+        assert(ClassSortedArrayMap._impl_Map.get(large, key) == (index % 2 ? NULL : (void *) (index + 1)));
+    }
+
+    // Testing Map_forEach() & forEachEntry()
+    char *previous = NULL;
+    unsigned long int visited = 0;
+    Map_forEach(large, entryKey, entryValue, {
+        assert(!previous || strcmp(previous, entryKey) < 0);
+        assert(ClassSortedArrayMap._impl_Map.get(large, entryKey) == entryValue);
+        previous = entryKey;
+        visited++;
+    });
+    assert(visited == 2000);
+
+    visited = 0;
+    ClassSortedArrayMap._impl_Map.forEachEntry(large, &countFirstTen, &visited);
+    assert(visited == 10);
+
+    delete(large);
+    delete(map);
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include <assert.h>
+#include <pthread.h>
+
+#include "../../src/ccomponents.h"
+
+#define ITEMS 100000
+
+static void *produce(void *argument) {
+    SpscQueue *queue = (SpscQueue *) argument;
+
+    for (unsigned long int index = 1; index <= ITEMS;)
+        if (ClassSpscQueue.offer(queue, (void *) index))
+            index++;
+
+    return NULL;
+}
+
+int main(int argc, char **argv) {
+
+    // Testing constructor
+    SpscQueue *queue = CreateSpscQueue(5);
+    assert(ClassSpscQueue.capacity(queue) == 8);
+    assert(!ClassSpscQueue.size(queue));
+    assert(!ClassSpscQueue.poll(queue));
+
+    // Testing offer() & poll()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+
+    for (int x = 0; x < 8; x++)
+        assert(ClassSpscQueue.offer(queue, testData[x % 4]));
+
+    assert(!ClassSpscQueue.offer(queue, testData[0]));
+    assert(ClassSpscQueue.size(queue) == 8);
+
+    for (int x = 0; x < 6; x++)
+        assert(ClassSpscQueue.poll(queue) == testData[x % 4]);
+
+    for (int x = 0; x < 4; x++)
+        assert(ClassSpscQueue.offer(queue, testData[x]));
+
+    assert(ClassSpscQueue.size(queue) == 6);
+
+    // Testing toString() & copy()
+    String *queueAsString = ClassSpscQueue._impl_CCObject.toString(queue);
+    delete(queueAsString);
+
+    SpscQueue *copy = ClassSpscQueue._impl_CCObject.copy(queue);
+    assert(ClassSpscQueue.size(copy) == 6);
+    assert(ClassSpscQueue.poll(copy) == testData[2]);
+    delete(copy);
+
+    assert(ClassSpscQueue.poll(queue) == testData[2]);
+    assert(ClassSpscQueue.poll(queue) == testData[3]);
+    for (int x = 0; x < 4; x++)
+        assert(ClassSpscQueue.poll(queue) == testData[x]);
+
+    assert(!ClassSpscQueue.poll(queue));
+
+    // Testing a producer & a consumer thread
+    pthread_t producer;
+    pthread_create(&producer, NULL, &produce, queue);
+
+    for (unsigned long int index = 1; index <= ITEMS;) {
+        void *value = ClassSpscQueue.poll(queue);
+        if (value)
+            assert(value == (void *) index++);
+    }
+
+    pthread_join(producer, NULL);
+    assert(!ClassSpscQueue.size(queue));
+
+    delete(queue);
+
+    return 0;
+}
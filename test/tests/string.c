@@ -42,6 +42,19 @@ int main(int argc, char **argv) {
     assert(!(strcmp(ClassString.getValue(string), "Hello world!93")));
     assert(ClassString.length(string) == 14);
 
+    String *grown = CreateString("ab");
+    for (int x = 0; x < 4; x++)
+        ClassString.add(grown, ClassString.getValue(grown));
+    assert(ClassString.length(grown) == 32 && ClassString.equalsChr(grown, "abababababababababababababababab"));
+
+    for (int x = 0; x < 100000; x++)
+        ClassString.add(grown, "xy");
+    assert(ClassString.length(grown) == 200032 && ClassString.charAt(grown, 200031) == 'y');
+
+    ClassString.setValue(grown, ClassString.getValue(grown) + 200030);
+    assert(ClassString.equalsChr(grown, "xy") && ClassString.length(grown) == 2);
+    delete(grown);
+
     // Testing charAt(), equals() and equalsChr()
     assert(ClassString.charAt(string, 4) == 'o');
     assert(ClassString.equalsChr(string, "Hello world!93"));
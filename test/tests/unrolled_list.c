@@ -0,0 +1,158 @@
+#include <assert.h>
+#include <string.h>
+
+#include "../../src/ccomponents.h"
+
+int main(int argc, char **argv) {
+    
+    // Testing constructor
+    UnrolledList *list = CreateUnrolledList();
+    assert(!ClassUnrolledList._impl_List.length(list));
+    assert(!ClassUnrolledList.getFirst(list) && !ClassUnrolledList.getLast(list));
+
+    // Testing push()
+    char *testData[4] =
+        {
+            "Hel", "lo ", "wor", "ld!"
+        };
+
+    for (int x = 0; x < 4; x++)
+        ClassUnrolledList._impl_List.add(list, testData[x]);
+
+    assert(ClassUnrolledList._impl_List.length(list) == 4);
+
+    for (int x = 0; x < 4; x++) 
+        assert(ClassUnrolledList._impl_List.get(list, x) == testData[x]);
+
+    // Testing set() & get()
+    ClassUnrolledList._impl_List.set(list, 2, testData[0]);
+
+    assert(ClassUnrolledList._impl_List.length(list) == 4);
+    assert(ClassUnrolledList._impl_List.get(list, 2) == ClassUnrolledList
+        ._impl_List.get(list, 0));
+
+    // Testing remove() & get()
+    ClassUnrolledList._impl_List.remove(list, 0);
+
+    assert(ClassUnrolledList._impl_List.length(list) == 3);
+    assert(ClassUnrolledList._impl_List.get(list, 0) == testData[1] &&
+           ClassUnrolledList._impl_List.get(list, 1) == testData[0] &&
+           ClassUnrolledList._impl_List.get(list, 2) == testData[3] );
+
+    // Testing toString()
+    String *listAsString = ClassUnrolledList._impl_List
+        ._impl_CCObject.toString(list);
+    delete(listAsString);
+
+    // Testing addFirst
+    ClassUnrolledList.addFirst(list, testData[2]);
+    assert(ClassUnrolledList._impl_List.length(list) == 4);
+    assert(ClassUnrolledList._impl_List.get(list, 0) == testData[2] &&
+           ClassUnrolledList._impl_List.get(list, 1) == testData[1] &&
+           ClassUnrolledList._impl_List.get(list, 2) == testData[0] &&
+           ClassUnrolledList._impl_List.get(list, 3) == testData[3] );
+
+    // Testing copy()
+    UnrolledList *copy = ClassUnrolledList._impl_List._impl_CCObject.copy(list);
+    assert(ClassUnrolledList._impl_List.length(copy) == 4);
+
+    for (int index = 0; index < 4; index++)
+        assert(ClassUnrolledList._impl_List.get(copy, index) == 
+               ClassUnrolledList._impl_List.get(list, index));
+
+    // Testing iterator() & List_forEachRemove()
+    ListIterator iterator = ClassUnrolledList._impl_List.iterator(list);
+    for (unsigned long int index = 0; index < ClassUnrolledList._impl_List.length(list); index++) {
+        assert(iterator.hasNext(&iterator));
+        assert(iterator.next(&iterator) == ClassUnrolledList._impl_List.get(list, index));
+    }
+    assert(!iterator.hasNext(&iterator));
+
+    // Values 0 .. 99 fill nodes of 32, 32, 32 and 4
+    UnrolledList *filtered = CreateUnrolledList();
+    for (unsigned long int index = 0; index < 100; index++)
+        ClassUnrolledList._impl_List.add(filtered, (void *) index);
+
+    // The second node empties and goes away under the iterator, the third one
+    // thins out until the last node is merged into it while it is being walked
+    unsigned long int visited = 0;
+    List_forEach(filtered, item, {
+        unsigned long int value = (unsigned long int) item;
+        visited++;
+
+        if ((value < 32 && value % 8) || (value >= 32 && value < 64) ||
+            (value >= 64 && value < 96 && value % 16) || value == 99)
+            List_forEachRemove(item);
+    });
+
+    unsigned long int remaining[9] = { 0, 8, 16, 24, 64, 80, 96, 97, 98 };
+    assert(visited == 100);
+    assert(ClassUnrolledList._impl_List.length(filtered) == 9);
+    for (unsigned long int index = 0; index < 9; index++)
+        assert(ClassUnrolledList._impl_List.get(filtered, index) == (void *) remaining[index]);
+
+    assert(ClassUnrolledList.getLast(filtered) == (void *) 98);
+    delete(filtered);
+
+    // Testing getFirst & getLast
+    assert(ClassUnrolledList.getFirst(list) == testData[2]);
+    assert(ClassUnrolledList.getLast(list) == testData[3]);
+
+    // Testing removeFirst & removeLast
+    ClassUnrolledList.removeFirst(list);
+    assert(ClassUnrolledList.getFirst(list) == testData[1]);
+    assert(ClassUnrolledList._impl_List.length(list) == 3);
+
+    ClassUnrolledList.removeLast(list);
+    assert(ClassUnrolledList.getLast(list) == testData[0]);
+    assert(ClassUnrolledList._impl_List.length(list) == 2);
+
+    // Testing values spread over many nodes & FIFO usage
+    for (unsigned long index = 0; index < 1000; index++) {
+        ClassUnrolledList.addFirst(copy, (void *) (index + 1));
+        ClassUnrolledList._impl_List.add(copy, (void *) (index + 1));
+    }
+
+    assert(ClassUnrolledList._impl_List.length(copy) == 2004);
+    assert(ClassUnrolledList.getFirst(copy) == (void *) 1000);
+    assert(ClassUnrolledList.getLast(copy) == (void *) 1000);
+    assert(ClassUnrolledList._impl_List.get(copy, 1000) == testData[2]);
+    assert(ClassUnrolledList._impl_List.get(copy, 1003) == testData[3]);
+
+    ClassUnrolledList._impl_List.remove(copy, 1500);
+    assert(ClassUnrolledList._impl_List.get(copy, 1500) == (void *) 498);
+    ClassUnrolledList._impl_List.remove(copy, 10);
+    assert(ClassUnrolledList._impl_List.get(copy, 10) == (void *) 989);
+    assert(ClassUnrolledList.getFirst(copy) == (void *) 1000);
+
+    // Testing remove() across nodes against a plain array
+    unsigned long expected[2002];
+    for (unsigned long index = 0; index < 2002; index++)
+        expected[index] = (unsigned long) ClassUnrolledList._impl_List.get(copy, index);
+
+    unsigned long expectedLength = 2002;
+    for (unsigned long seed = 7; expectedLength > 10; seed = seed * 31 + 11) {
+        unsigned long index = seed % expectedLength;
+        ClassUnrolledList._impl_List.remove(copy, index);
+        memmove(expected + index, expected + index + 1, (expectedLength - index - 1) * sizeof(unsigned long));
+        expectedLength--;
+    }
+
+    assert(ClassUnrolledList._impl_List.length(copy) == expectedLength);
+    for (unsigned long index = 0; index < expectedLength; index++)
+        assert(ClassUnrolledList._impl_List.get(copy, index) == (void *) expected[index]);
+
+    while (ClassUnrolledList._impl_List.length(copy))
+        ClassUnrolledList.removeFirst(copy);
+    ClassUnrolledList.removeFirst(copy);
+    assert(!ClassUnrolledList.getFirst(copy));
+
+    List_forEach(list, item, {
+        assert(item);
+    });
+
+    delete(copy);
+    delete(list);
+
+    return 0;
+}
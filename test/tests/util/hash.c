@@ -0,0 +1,36 @@
+#include <assert.h>
+#include <string.h>
+
+#include "../../../src/util/hash.h"
+
+int main(int argc, char **argv) {
+
+    // Testing determinism & unaligned input
+    char buffer[64] = "  The quick brown fox jumps over the lazy dog";
+    char aligned[64];
+    memcpy(aligned, buffer + 2, 43);
+
+    assert(_hash_bytes(buffer + 2, 43) == _hash_bytes(aligned, 43));
+    assert(_hash_bytes("", 0) == _hash_bytes(buffer, 0));
+
+    // Testing that the length and every byte matter
+    for (unsigned long int length = 1; length < 43; length++)
+        assert(_hash_bytes(aligned, length) != _hash_bytes(aligned, length - 1));
+
+    for (unsigned long int index = 0; index < 43; index++) {
+        uint64_t original = _hash_bytes(aligned, 43);
+        aligned[index] ^= 1;
+        assert(_hash_bytes(aligned, 43) != original);
+        aligned[index] ^= 1;
+    }
+
+    // Testing that the low bits spread sequential keys
+    unsigned int buckets[16] = { 0 };
+    for (unsigned long int key = 0; key < 1600; key++)
+        buckets[_hash_bytes(&key, sizeof(key)) & 15]++;
+
+    for (int bucket = 0; bucket < 16; bucket++)
+        assert(buckets[bucket] > 50 && buckets[bucket] < 150);
+
+    return 0;
+}